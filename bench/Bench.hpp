@@ -0,0 +1,52 @@
+/// @file   Bench.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Minimal micro-benchmark registry used by DarkOrbitBench.
+
+#pragma once
+
+// C++ includes
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Bench
+{
+    /// Runs the measured operation @p iterations times
+    using Function = std::function<void(std::size_t iterations)>;
+
+    struct Benchmark
+    {
+        std::string name;
+        Function    function;
+    };
+
+    inline auto registry() -> std::vector<Benchmark> &
+    {
+        static std::vector<Benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    /// Registers a benchmark from a static initializer
+    struct Registrar
+    {
+        Registrar(std::string name, Function function)
+        {
+            registry().push_back({ std::move(name), std::move(function) });
+        }
+    };
+
+    /// Keeps the compiler from optimizing away the computation of @p value
+    template<typename T>
+    inline void doNotOptimize(T const & value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile char const * sink;
+        sink = reinterpret_cast<char const volatile *>(&value);
+#endif
+    }
+} // !namespace Bench
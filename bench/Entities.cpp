@@ -0,0 +1,105 @@
+/// @file   Entities.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// One simulation tick over 10k entities: the structure-of-arrays store versus the same fields
+/// kept one struct per entity.
+
+// Project includes
+#include "Bench.hpp"
+#include "../src/core/Constants.hpp"
+#include "../src/game/Systems.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t shipCount       = 8'000;
+    constexpr std::size_t projectileCount = 2'000;
+
+    // Long enough for no projectile to expire while measured
+    constexpr float lifetime = 1e6f;
+
+    auto tick() -> float { return 1.f / static_cast<float>(Constants::tickRate); }
+
+    auto velocity(std::size_t i) -> float { return static_cast<float>(i % 200) - 100.f; }
+
+    auto entities() -> Game::EntityStore &
+    {
+        static auto store = [] {
+            Game::EntityStore s;
+            s.reserve(shipCount, projectileCount);
+            for (std::size_t i = 0; i < shipCount; ++i)
+            {
+                s.spawn(Game::ShipDesc{
+                    .x = static_cast<float>(i), .y = 0.f, .vx = velocity(i), .vy = velocity(i + 7),
+                    .hp = 10'000, .maxHp = 10'000, .shield = 0, .maxShield = 320'000,
+                    .shieldRegen = 50,
+                });
+            }
+            for (std::size_t i = 0; i < projectileCount; ++i)
+            {
+                s.spawn(Game::ProjectileDesc{
+                    .x = 0.f, .y = static_cast<float>(i), .vx = velocity(i), .vy = velocity(i + 3),
+                    .lifetime = lifetime, .damage = 1'000,
+                });
+            }
+            return s;
+        }();
+        return store;
+    }
+
+    Bench::Registrar const soa("Systems::update 10k entities (SoA)", [](std::size_t n) {
+        auto &     store = entities();
+        auto const dt    = tick();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            Game::Systems::update(store, dt);
+            Bench::doNotOptimize(store.ships().motion.x.front());
+        }
+    });
+
+    // What the entities would look like as ShipStats-like structs
+    struct Entity
+    {
+        float         x, y, vx, vy;
+        std::uint16_t sprite;
+        float         rotation;
+        std::uint32_t hp, maxHp, shield, maxShield, shieldRegen;
+        float         lifetime;
+        std::uint32_t damage;
+        bool          projectile;
+    };
+
+    Bench::Registrar const aos("Same tick, one struct per entity (AoS)", [](std::size_t n) {
+        static auto all = [] {
+            std::vector<Entity> v;
+            for (std::size_t i = 0; i < shipCount + projectileCount; ++i)
+            {
+                auto const projectile = i >= shipCount;
+                v.push_back({ static_cast<float>(i), 0.f, velocity(i), velocity(i + 7), 0, 0.f,
+                              10'000, 10'000, 0, 320'000, projectile ? 0u : 50u,
+                              lifetime, 1'000, projectile });
+            }
+            return v;
+        }();
+
+        auto const dt = tick();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            for (auto & e : all)
+            {
+                e.x += e.vx * dt;
+                e.y += e.vy * dt;
+                if (e.projectile)
+                    e.lifetime -= dt;
+                else
+                    e.shield = std::min(e.shield + e.shieldRegen, e.maxShield);
+            }
+            Bench::doNotOptimize(all.front().x);
+        }
+    });
+} // !namespace
@@ -0,0 +1,84 @@
+/// @file   Formulas.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Level lookups, as on every XP grant: the constexpr table versus the former log2l formula,
+/// over XP spread across all levels. The boundary benchmark also checks both on each side of every
+/// level threshold, and throws if the table is off anywhere or log2l is off other than by rounding
+/// the XP just below a high threshold up to it (from level 49 with an x87 long double).
+
+// Project includes
+#include "Bench.hpp"
+#include "../src/core/Exception.hpp"
+#include "../src/game/Formulas.hpp"
+
+// C++ includes
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t sampleCount = 4'096;
+
+    /// What getLevelFromXp() used to be. Garbage below Formulas::firstLevelUpXp.
+    auto legacyLevel(uint64_t xp) -> uint8_t
+    {
+        return static_cast<uint8_t>(2 + std::log2l(static_cast<long double>(xp) / 10'000));
+    }
+
+    /// Exponentially distributed, as players' XP is
+    auto samples() -> std::vector<uint64_t> const &
+    {
+        static auto const xps = [] {
+            std::mt19937_64                    random(42);
+            std::uniform_int_distribution<int> shift(14, 50);
+            std::vector<uint64_t>              v(sampleCount);
+            for (auto & xp : v)
+                xp = (random() >> 14) >> (50 - shift(random));
+            return v;
+        }();
+        return xps;
+    }
+
+    template<typename F>
+    void lookUp(std::size_t n, F && level)
+    {
+        auto const & xps = samples();
+        for (std::size_t i = 0; i < n; ++i)
+            Bench::doNotOptimize(level(xps[i % sampleCount]));
+    }
+
+    Bench::Registrar const table("Formulas::getLevelFromXp (table)", [](std::size_t n) {
+        lookUp(n, [](uint64_t xp) { return Formulas::getLevelFromXp(xp); });
+    });
+
+    Bench::Registrar const legacy("Legacy log2l level formula", [](std::size_t n) {
+        lookUp(n, legacyLevel);
+    });
+
+    Bench::Registrar const progress("Formulas::levelProgress", [](std::size_t n) {
+        lookUp(n, [](uint64_t xp) { return Formulas::levelProgress(xp); });
+    });
+
+    Bench::Registrar const boundaries("Formulas level boundaries vs log2l", [](std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            for (uint8_t level = 2; level <= Formulas::maxLevel; ++level)
+            {
+                auto const threshold = Formulas::xpForLevel(level);
+                for (auto const xp : { threshold - 1, threshold, threshold + 1 })
+                {
+                    auto const expected = xp < threshold ? level - 1 : level;
+                    auto const actual   = Formulas::getLevelFromXp(xp);
+                    auto const legacy   = legacyLevel(xp);
+                    Core::bAssert(actual == expected, "Level {} at {} XP, expected {}", actual,
+                                  xp, expected);
+                    Core::bAssert(legacy == expected || (xp + 1 == threshold && legacy == level),
+                                  "log2l level {} at {} XP, expected {}", legacy, xp, expected);
+                }
+            }
+        }
+    });
+} // !namespace
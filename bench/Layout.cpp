@@ -0,0 +1,48 @@
+/// @file   Layout.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// The space map's HUD layout: solving it whole, against re-solving after one node changed
+/// size, as a value text does. Run from the repository root.
+
+// Project includes
+#include "Bench.hpp"
+#include "../src/core/Constants.hpp"
+#include "../src/engine/AssetArchive.hpp"
+#include "../src/engine/Layout.hpp"
+
+namespace
+{
+    auto layout() -> Engine::Layout &
+    {
+        static auto instance = [] {
+            Engine::AssetArchive const none;
+            Engine::Layout l({ static_cast<float>(Constants::gameViewWidth),
+                               static_cast<float>(Constants::gameViewHeight) });
+            l.load("assets/layout/spacemap.layout", none);
+            l.solve();
+            return l;
+        }();
+        return instance;
+    }
+
+    Bench::Registrar const solve("Engine::Layout::solve (whole HUD)", [](std::size_t n) {
+        auto & l = layout();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            l.solve();
+            Bench::doNotOptimize(l.rect(Engine::Layout::screen));
+        }
+    });
+
+    /// The configuration switch has a label, a background and a sibling anchored to it
+    Bench::Registrar const resize("Engine::Layout::resize (one subtree)", [](std::size_t n) {
+        auto &     l    = layout();
+        auto const node = l.node("configInactive");
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            l.resize(node, { 30.f + static_cast<float>(i % 2), 20.f });
+            Bench::doNotOptimize(l.rect(node));
+        }
+    });
+} // !namespace
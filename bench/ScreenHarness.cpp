@@ -0,0 +1,201 @@
+/// @file   ScreenHarness.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "ScreenHarness.hpp"
+
+// Project includes
+#include "../src/core/Constants.hpp"
+#include "../src/core/Exception.hpp"
+#include "../src/core/Profiler.hpp"
+#include "../src/engine/AssetArchive.hpp"
+#include "../src/engine/FontManager.hpp"
+#include "../src/engine/ScreenManager.hpp"
+
+// Third-party includes
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/System/Sleep.hpp>
+#include <spdlog/spdlog.h>
+
+// C++ includes
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr std::size_t warmUpFrames = 30; // Glyphs, caches and driver warm-up, not measured
+
+    auto parseEvent(std::istringstream & line, std::string const & type) -> sf::Event
+    {
+        sf::Event event{};
+        int       value = 0;
+
+        /**/ if (type == "mousemove")
+        {
+            event.type = sf::Event::MouseMoved;
+            line >> event.mouseMove.x >> event.mouseMove.y;
+        }
+        else if (type == "mousedown" || type == "mouseup")
+        {
+            event.type = type == "mousedown" ? sf::Event::MouseButtonPressed
+                                             : sf::Event::MouseButtonReleased;
+            line >> value >> event.mouseButton.x >> event.mouseButton.y;
+            event.mouseButton.button = static_cast<sf::Mouse::Button>(value);
+        }
+        else if (type == "keydown" || type == "keyup")
+        {
+            event.type = type == "keydown" ? sf::Event::KeyPressed : sf::Event::KeyReleased;
+            line >> value;
+            event.key.code = static_cast<sf::Keyboard::Key>(value);
+        }
+        else if (type == "resize")
+        {
+            event.type = sf::Event::Resized;
+            line >> event.size.width >> event.size.height;
+        }
+        else
+            throw Core::Exception("Unknown event type '{}'", type);
+
+        Core::bAssert(!line.fail(), "Missing arguments for '{}'", type);
+        return event;
+    }
+} // !namespace
+
+auto Bench::loadScript(std::filesystem::path const & path) -> std::vector<ScriptedEvent>
+{
+    std::ifstream file(path);
+    Core::bAssert(file.is_open(), "Failed to open event script {}", path.string());
+
+    std::vector<ScriptedEvent> script;
+    std::string                line;
+    for (std::size_t number = 1; std::getline(file, line); ++number)
+    {
+        line = line.substr(0, line.find('#'));
+
+        std::istringstream stream(line);
+        std::size_t        frame = 0;
+        std::string        type;
+        if (!(stream >> frame >> type))
+            continue; // Blank or comment
+
+        try
+        {
+            script.push_back({ frame, parseEvent(stream, type) });
+        }
+        catch (...)
+        {
+            THROW_NESTED("Invalid event at {}:{}", path.string(), number);
+        }
+    }
+
+    std::stable_sort(script.begin(), script.end(),
+                     [](auto const & lhs, auto const & rhs) { return lhs.frame < rhs.frame; });
+    return script;
+}
+
+auto Bench::runScreen(ScreenBenchmark const & screen, std::size_t frames,
+                      std::vector<ScriptedEvent> const & script) -> ScreenResult
+{
+    Core::bAssert(frames > 0, "Nothing to measure");
+
+    Engine::AssetArchive archive;
+    static_cast<void>(archive.mount("assets.pak"));
+
+    Engine::FontManager fontManager;
+    fontManager.load("orbitron", "assets/font/orbitron-bold.ttf", archive);
+    fontManager.prewarm("orbitron", Constants::fontSize, { 0.f, Constants::textOutline });
+
+    // No window: no vsync, nothing presented
+    sf::RenderTexture target;
+    Core::bAssert(target.create(Constants::gameViewWidth, Constants::gameViewHeight),
+                  "Failed to create the offscreen target");
+
+    Engine::ScreenManager screenManager(archive);
+    screen.push(screenManager, fontManager);
+    while (screenManager.loading())
+    {
+        sf::sleep(sf::milliseconds(1));
+        screenManager.update();
+    }
+
+    std::array<Phase, 5> phases{ { { "events" }, { "update" }, { "publish" }, { "draw" },
+                                   { "display" } } };
+    auto const tick = sf::seconds(1.f / static_cast<float>(Constants::tickRate));
+    auto       next = script.begin();
+
+    auto const measure = [](Phase * phase, auto && f) {
+        if (!phase)
+            return f();
+
+        auto const before = Core::Profiler::counters();
+        auto const start  = Clock::now();
+        f();
+        auto const elapsed = Clock::now() - start;
+        auto const after   = Core::Profiler::counters();
+
+        phase->nsPerFrame          += std::chrono::duration<double, std::nano>(elapsed).count();
+        phase->allocationsPerFrame += static_cast<double>(after.allocations - before.allocations);
+        phase->drawCallsPerFrame   += static_cast<double>(after.drawCalls   - before.drawCalls);
+        phase->rebuiltWidgetsPerFrame +=
+            static_cast<double>(after.rebuiltWidgets - before.rebuiltWidgets);
+    };
+
+    ScreenResult result;
+
+    for (std::size_t i = 0; i < warmUpFrames + frames; ++i)
+    {
+        auto const measured  = i >= warmUpFrames;
+        auto const frame     = i - warmUpFrames;
+        auto const screens   = screenManager.active();
+        auto const phase     = [&](std::size_t n) { return measured ? &phases[n] : nullptr; };
+        auto const rebuilt   = Core::Profiler::counters().rebuiltWidgets;
+        auto       delivered = false; // Frames without events should rebuild no widget
+
+        measure(phase(0), [&] {
+            for (; measured && next != script.end() && next->frame == frame; ++next)
+            {
+                for (auto && s : screens)
+                    s->onEvent(next->event);
+                delivered = true;
+            }
+        });
+        measure(phase(1), [&] { for (auto && s : screens) s->update(tick); });
+        measure(phase(2), [&] { for (auto && s : screens) s->publish();    });
+        measure(phase(3), [&] {
+            target.clear();
+            for (auto && s : screens)
+                s->draw(target, 1.f);
+        });
+        measure(phase(4), [&] { target.display(); });
+
+        if (measured && !delivered)
+        {
+            ++result.staticFrames;
+            if (Core::Profiler::counters().rebuiltWidgets != rebuilt)
+                ++result.rebuildingStaticFrames;
+        }
+    }
+
+    for (auto & phase : phases)
+    {
+        phase.nsPerFrame             /= static_cast<double>(frames);
+        phase.allocationsPerFrame    /= static_cast<double>(frames);
+        phase.drawCallsPerFrame      /= static_cast<double>(frames);
+        phase.rebuiltWidgetsPerFrame /= static_cast<double>(frames);
+    }
+
+    // Nothing changed: whatever was re-laid-out was rebuilt for nothing
+    if (result.rebuildingStaticFrames > 0)
+    {
+        spdlog::warn("[ScreenHarness] {} of {} frames without events rebuilt HUD widgets",
+                     result.rebuildingStaticFrames, result.staticFrames);
+    }
+
+    result.phases.assign(phases.begin(), phases.end());
+    return result;
+}
@@ -0,0 +1,84 @@
+/// @file   ScreenHarness.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Runs a whole Engine::Screen offscreen for a fixed number of frames, replaying a scripted
+/// event stream, and measures each phase of the frame.
+
+#pragma once
+
+// third-party includes
+#include <SFML/Window/Event.hpp>
+
+// C++ includes
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Engine
+{
+    class FontManager;
+    class ScreenManager;
+} // !namespace Engine
+
+namespace Bench
+{
+    /// Pushes the screen under test
+    using ScreenFactory = std::function<void(Engine::ScreenManager &, Engine::FontManager const &)>;
+
+    struct ScreenBenchmark
+    {
+        std::string   name;
+        ScreenFactory push;
+    };
+
+    inline auto screenRegistry() -> std::vector<ScreenBenchmark> &
+    {
+        static std::vector<ScreenBenchmark> screens;
+        return screens;
+    }
+
+    /// Registers a screen from a static initializer
+    struct ScreenRegistrar
+    {
+        ScreenRegistrar(std::string name, ScreenFactory push)
+        {
+            screenRegistry().push_back({ std::move(name), std::move(push) });
+        }
+    };
+
+    struct ScriptedEvent
+    {
+        std::size_t frame; ///< Delivered before this frame's update, counting from 0
+        sf::Event   event;
+    };
+
+    /// One event per line: `<frame> <type> <args...>`, '#' starts a comment. Types:
+    /// mousemove x y | mousedown button x y | mouseup button x y | keydown code | keyup code |
+    /// resize width height
+    auto loadScript(std::filesystem::path const & path) -> std::vector<ScriptedEvent>;
+
+    struct Phase
+    {
+        std::string name;
+        double      nsPerFrame             = 0.;
+        double      allocationsPerFrame    = 0.; ///< 0 unless built with DARKORBIT_PROFILING
+        double      drawCallsPerFrame      = 0.; ///< Idem
+        double      rebuiltWidgetsPerFrame = 0.; ///< Idem, HUD widgets re-laid-out
+    };
+
+    struct ScreenResult
+    {
+        std::vector<Phase> phases;                     ///< Events, update, publish, draw, display
+        std::size_t        staticFrames           = 0; ///< Measured frames without events
+        std::size_t        rebuildingStaticFrames = 0; ///< Of those, rebuilding HUD widgets
+    };
+
+    /// Loads the screen's assets, warms it up, then runs @p frames measured frames at a fixed
+    /// tick. A static frame should rebuild no widget: those that do are counted, and warned
+    /// about, when built with DARKORBIT_PROFILING.
+    auto runScreen(ScreenBenchmark const & screen, std::size_t frames,
+                   std::vector<ScriptedEvent> const & script) -> ScreenResult;
+} // !namespace Bench
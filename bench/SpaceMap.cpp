@@ -0,0 +1,19 @@
+/// @file   SpaceMap.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Whole-frame benchmark of the space map: DarkOrbitBench --screen SpaceMap
+/// Without a server nothing changes on it, and it takes no input: its frames are static.
+
+// Project includes
+#include "ScreenHarness.hpp"
+#include "../src/engine/ScreenManager.hpp"
+#include "../src/screens/SpaceMap.hpp"
+
+namespace
+{
+    Bench::ScreenRegistrar const spaceMap("SpaceMap", [](Engine::ScreenManager & manager,
+                                                         Engine::FontManager const & fonts) {
+        manager.push<Screens::SpaceMapScreen>(fonts);
+    });
+} // !namespace
@@ -0,0 +1,139 @@
+/// @file   SpatialGrid.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Spatial grid queries and re-indexing at 10k and 100k entities spread over the map, against a
+/// linear scan of the entity store.
+
+// Project includes
+#include "Bench.hpp"
+#include "../src/core/Constants.hpp"
+#include "../src/game/Systems.hpp"
+
+// C++ includes
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+
+namespace
+{
+    constexpr auto cellSize = 256.f;
+    constexpr auto radius   = 600.f; // Laser range
+
+    struct World
+    {
+        Game::EntityStore entities;
+        Game::SpatialGrid grid{ Constants::mapWidth, Constants::mapHeight, cellSize };
+    };
+
+    auto world(std::size_t count) -> World &
+    {
+        static std::unique_ptr<World> worlds[2];
+        auto & w = worlds[count > 10'000 ? 1 : 0];
+        if (w)
+            return *w;
+
+        w = std::make_unique<World>();
+        w->entities.reserve(count, 0);
+
+        std::mt19937                          random(42);
+        std::uniform_real_distribution<float> x(0.f, Constants::mapWidth);
+        std::uniform_real_distribution<float> y(0.f, Constants::mapHeight);
+        std::uniform_real_distribution<float> v(-300.f, 300.f);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            w->entities.spawn(Game::ShipDesc{ .x = x(random), .y = y(random),
+                                              .vx = v(random), .vy = v(random) });
+        }
+        Game::Systems::index(w->entities, w->grid);
+        return *w;
+    }
+
+    /// Query centers, cycled through so that every query doesn't hit the same cells
+    auto center(std::size_t i) -> std::pair<float, float>
+    {
+        auto const step = static_cast<float>(i % 64);
+        return { 500.f + step * 311.f, 500.f + step * 187.f };
+    }
+
+    void registerAll(std::size_t count)
+    {
+        auto const suffix = " (" + std::to_string(count / 1'000) + "k)";
+
+        auto const add = [](std::string name, Bench::Function function) {
+            Bench::registry().push_back({ std::move(name), std::move(function) });
+        };
+
+        add("SpatialGrid view culling" + suffix, [count](std::size_t n) {
+            auto const & grid = world(count).grid;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto const [x, y] = center(i);
+                auto const width  = static_cast<float>(Constants::gameViewWidth);
+                auto const height = static_cast<float>(Constants::gameViewHeight);
+
+                std::uint32_t visible = 0;
+                grid.forEachIn({ x, y, width, height }, [&](auto, float, float) { ++visible; });
+                Bench::doNotOptimize(visible);
+            }
+        });
+
+        add("SpatialGrid radius" + suffix, [count](std::size_t n) {
+            auto const & grid = world(count).grid;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto const [x, y] = center(i);
+
+                std::uint32_t inRange = 0;
+                grid.forEachInRadius(x, y, radius, [&](auto, float, float) { ++inRange; });
+                Bench::doNotOptimize(inRange);
+            }
+        });
+
+        add("SpatialGrid nearest" + suffix, [count](std::size_t n) {
+            auto const & grid = world(count).grid;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto const [x, y] = center(i);
+                Bench::doNotOptimize(grid.nearest(x, y, 5'000.f, [](auto) { return true; }));
+            }
+        });
+
+        add("Linear scan radius" + suffix, [count](std::size_t n) {
+            auto const & motion = world(count).entities.ships().motion;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                auto const [x, y] = center(i);
+
+                std::uint32_t inRange = 0;
+                for (std::size_t e = 0; e < motion.x.size(); ++e)
+                {
+                    auto const dx = motion.x[e] - x;
+                    auto const dy = motion.y[e] - y;
+                    inRange += dx * dx + dy * dy <= radius * radius;
+                }
+                Bench::doNotOptimize(inRange);
+            }
+        });
+
+        // One tick of movement, then re-indexing: most entities stay in their cell
+        add("Systems::update + index" + suffix, [count](std::size_t n) {
+            auto &     w  = world(count);
+            auto const dt = 1.f / static_cast<float>(Constants::tickRate);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                Game::Systems::update(w.entities, i % 2 ? dt : -dt); // Back and forth
+                Game::Systems::index(w.entities, w.grid);
+            }
+            Bench::doNotOptimize(w.grid.size());
+        });
+    }
+
+    [[maybe_unused]] auto const registered = [] {
+        registerAll(10'000);
+        registerAll(100'000);
+        return true;
+    }();
+} // !namespace
@@ -0,0 +1,101 @@
+/// @file   TextHelpers.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Text helpers of SfmlText.cpp, as used by the HUD layouts, and the batch the HUD draws texts
+/// with. Run from the repository root.
+
+// Project includes
+#include "Bench.hpp"
+#include "../src/core/Constants.hpp"
+#include "../src/core/Exception.hpp"
+#include "../src/engine/FontManager.hpp"
+#include "../src/engine/TextBatch.hpp"
+#include "../src/utils/SfmlText.hpp"
+
+// Third-party includes
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+// C++ includes
+#include <memory>
+#include <vector>
+
+namespace
+{
+    auto font() -> sf::Font const &
+    {
+        static auto const instance = [] {
+            sf::Font f;
+            Core::bAssert(f.loadFromFile("assets/font/orbitron-bold.ttf"), "Failed to load font");
+            return f;
+        }();
+        return instance;
+    }
+
+    /// Pre-warmed as the HUD's, which TextBatch requires
+    auto fonts() -> Engine::FontManager const &
+    {
+        static auto const instance = [] {
+            auto manager = std::make_unique<Engine::FontManager>();
+            manager->load("orbitron", "assets/font/orbitron-bold.ttf");
+            manager->prewarm("orbitron", Constants::fontSize, { 0.f, Constants::textOutline });
+            return manager;
+        }();
+        return *instance;
+    }
+
+    Bench::Registrar const makeText("Utils::makeText", [](std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i)
+            Bench::doNotOptimize(Utils::makeText(font(), "{}", Utils::grouped(1'234'567 + i)));
+    });
+
+    Bench::Registrar const setString("Utils::setString + setTextPosition", [](std::size_t n) {
+        auto text = Utils::makeText(font(), "");
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            Utils::setString(text, "{}", Utils::grouped(1'234'567 + i));
+            Utils::setTextPosition(text, 100.f, 20.f);
+            Bench::doNotOptimize(text.getPosition());
+        }
+    });
+
+    Bench::Registrar const centerIn("Utils::centerIn", [](std::size_t n) {
+        sf::Sprite background;
+        background.setTextureRect({ 0, 0, 120, 18 });
+
+        auto text = Utils::makeText(font(), "1.234.567");
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            Utils::centerIn(text, background);
+            Bench::doNotOptimize(text.getPosition());
+        }
+    });
+
+    /// A HUD's worth of texts, one of which changes every iteration, as a bound value does
+    Bench::Registrar const textBatch("Engine::TextBatch::update (1 of 30 texts changed)",
+                                     [](std::size_t n) {
+        std::vector<sf::Text> texts;
+        for (int i = 0; i < 30; ++i)
+        {
+            auto & text = texts.emplace_back(Utils::makeText(fonts().font("orbitron"), "{}",
+                                                             Utils::grouped(i)));
+            Utils::setTextPosition(text, 10.f, 20.f * static_cast<float>(i));
+            if (i % 2)
+                Utils::setOutline(text, sf::Color::Black);
+        }
+
+        Engine::TextBatch batch;
+        for (auto && text : texts)
+            static_cast<void>(batch.add(text, fonts()));
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            Utils::setString(texts[i % texts.size()], "{}", Utils::grouped(1'234'567 + i));
+            for (std::size_t t = 0; t < texts.size(); ++t)
+                Bench::doNotOptimize(batch.update(t, texts[t], fonts()));
+        }
+    });
+} // !namespace
@@ -0,0 +1,56 @@
+/// @file   TextureLookup.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Interned TextureId lookups versus string-keyed ones. Run from the repository root.
+
+// Project includes
+#include "Bench.hpp"
+#include "../src/engine/TextureManager.hpp"
+
+// C++ includes
+#include <unordered_map>
+
+namespace
+{
+    auto textureManager() -> Engine::TextureManager const &
+    {
+        static auto const manager = [] {
+            Engine::TextureManager m;
+            m.load("header",               "assets/ui/header.png");
+            m.load("inventory_content_bg", "assets/ui/inventory_content_bg.png");
+            m.pack();
+            return m;
+        }();
+        return manager;
+    }
+
+    Bench::Registrar const byId("TextureManager::sprite(TextureId)", [](std::size_t n) {
+        auto const & manager = textureManager();
+        auto const   id      = manager.id("inventory_content_bg").value();
+        for (std::size_t i = 0; i < n; ++i)
+            Bench::doNotOptimize(manager.sprite(id));
+    });
+
+    Bench::Registrar const byName("TextureManager::sprite(string_view)", [](std::size_t n) {
+        auto const & manager = textureManager();
+        for (std::size_t i = 0; i < n; ++i)
+            Bench::doNotOptimize(manager.sprite("inventory_content_bg"));
+    });
+
+    // What sprite(std::string const &) used to do: build a std::string, contains(), then at()
+    Bench::Registrar const legacy("Legacy std::string contains() + at()", [](std::size_t n) {
+        auto const & manager = textureManager();
+        std::unordered_map<std::string, Engine::TextureId> const ids = {
+            { "header",               manager.id("header").value()               },
+            { "inventory_content_bg", manager.id("inventory_content_bg").value() },
+        };
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            std::string const name = "inventory_content_bg";
+            if (ids.contains(name))
+                Bench::doNotOptimize(manager.sprite(ids.at(name)));
+        }
+    });
+} // !namespace
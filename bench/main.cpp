@@ -0,0 +1,196 @@
+/// @file   main.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Usage: DarkOrbitBench [--json] [filter]
+/// Runs every registered micro-benchmark whose name contains @c filter.
+///
+/// Usage: DarkOrbitBench [--json] --screen <name> [--frames N] [--events script] [--hardware-gl]
+/// Runs a registered screen offscreen, under a software OpenGL (Mesa llvmpipe) unless
+/// --hardware-gl is given, and reports the cost of each phase of its frames.
+
+// Project includes
+#include "Bench.hpp"
+#include "ScreenHarness.hpp"
+#include "../src/core/Exception.hpp"
+#include "../src/core/Profiler.hpp"
+
+// Third-party includes
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+// C++ includes
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Options
+    {
+        bool                  json       = false;
+        bool                  hardwareGl = false;
+        std::string_view      filter;
+        std::string_view      screen;
+        std::size_t           frames     = 600;
+        std::filesystem::path events;
+    };
+
+    struct Result
+    {
+        std::string_view name;
+        std::size_t      iterations;
+        double           nsPerOp;
+    };
+
+    auto parseOptions(int argc, char * argv[]) -> Options
+    {
+        Options options;
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string_view const arg = argv[i];
+            auto const value = [&] {
+                Core::bAssert(i + 1 < argc, "Missing value for {}", arg);
+                return std::string_view(argv[++i]);
+            };
+
+            /**/ if (arg == "--json")
+                options.json = true;
+            else if (arg == "--hardware-gl")
+                options.hardwareGl = true;
+            else if (arg == "--screen")
+                options.screen = value();
+            else if (arg == "--frames")
+                options.frames = std::stoul(std::string(value()));
+            else if (arg == "--events")
+                options.events = value();
+            else
+                options.filter = arg;
+        }
+        return options;
+    }
+
+    /// Must happen before the first GL context is created
+    void forceSoftwareGl()
+    {
+#ifdef _WIN32
+        _putenv_s("LIBGL_ALWAYS_SOFTWARE", "1");
+#else
+        setenv("LIBGL_ALWAYS_SOFTWARE", "1", 1);
+#endif
+    }
+
+    auto run(Bench::Benchmark const & benchmark) -> Result
+    {
+        constexpr auto minDuration = std::chrono::milliseconds(200);
+
+        benchmark.function(1); // Warm-up
+
+        // Grow the iteration count until a run is long enough to be measured reliably
+        for (std::size_t iterations = 1;; iterations *= 4)
+        {
+            auto const start = Clock::now();
+            benchmark.function(iterations);
+            auto const elapsed = Clock::now() - start;
+
+            if (elapsed >= minDuration || iterations >= (std::size_t(1) << 40))
+            {
+                auto const ns = std::chrono::duration<double, std::nano>(elapsed).count();
+                return { benchmark.name, iterations, ns / static_cast<double>(iterations) };
+            }
+        }
+    }
+
+    void runMicroBenchmarks(Options const & options)
+    {
+        std::vector<Result> results;
+        for (auto && benchmark : Bench::registry())
+        {
+            if (benchmark.name.find(options.filter) != std::string::npos)
+            {
+                results.push_back(run(benchmark));
+                if (!options.json)
+                {
+                    fmt::print("{:<50} {:>12.2f} ns/op {:>14} iterations\n", results.back().name,
+                               results.back().nsPerOp, results.back().iterations);
+                }
+            }
+        }
+
+        if (options.json)
+        {
+            fmt::print("{{\n  \"benchmarks\": [");
+            for (std::size_t i = 0; i < results.size(); ++i)
+            {
+                fmt::print("{}\n    {{ \"name\": \"{}\", \"iterations\": {}, "
+                           "\"ns_per_op\": {:.3f} }}", i ? "," : "", results[i].name,
+                           results[i].iterations, results[i].nsPerOp);
+            }
+            fmt::print("\n  ]\n}}\n");
+        }
+    }
+
+    void runScreen(Options const & options)
+    {
+        auto const & screens = Bench::screenRegistry();
+        auto const   screen  = std::find_if(screens.begin(), screens.end(),
+                                            [&](auto & s) { return s.name == options.screen; });
+        Core::bAssert(screen != screens.end(), "No screen benchmark named '{}'", options.screen);
+
+        if (!options.hardwareGl)
+            forceSoftwareGl();
+
+        auto const   script = options.events.empty() ? std::vector<Bench::ScriptedEvent>()
+                                                     : Bench::loadScript(options.events);
+        auto const   result = Bench::runScreen(*screen, options.frames, script);
+        auto const & phases = result.phases;
+
+        if (!options.json)
+        {
+            for (auto && phase : phases)
+            {
+                fmt::print("{:<10} {:>12.0f} ns/frame {:>10.1f} allocations/frame "
+                           "{:>8.1f} draw calls/frame {:>8.2f} rebuilt widgets/frame\n",
+                           phase.name, phase.nsPerFrame, phase.allocationsPerFrame,
+                           phase.drawCallsPerFrame, phase.rebuiltWidgetsPerFrame);
+            }
+            fmt::print("{} of {} static frames rebuilt widgets\n", result.rebuildingStaticFrames,
+                       result.staticFrames);
+            return;
+        }
+
+        fmt::print("{{\n  \"screen\": \"{}\",\n  \"frames\": {},\n  \"software_gl\": {},\n"
+                   "  \"counters\": {},\n  \"static_frames\": {},\n"
+                   "  \"rebuilding_static_frames\": {},\n  \"phases\": [", screen->name,
+                   options.frames, !options.hardwareGl, Core::Profiler::enabled(),
+                   result.staticFrames, result.rebuildingStaticFrames);
+        for (std::size_t i = 0; i < phases.size(); ++i)
+        {
+            fmt::print("{}\n    {{ \"name\": \"{}\", \"ns_per_frame\": {:.1f}, "
+                       "\"allocations_per_frame\": {:.2f}, \"draw_calls_per_frame\": {:.2f}, "
+                       "\"rebuilt_widgets_per_frame\": {:.2f} }}", i ? "," : "", phases[i].name,
+                       phases[i].nsPerFrame, phases[i].allocationsPerFrame,
+                       phases[i].drawCallsPerFrame, phases[i].rebuiltWidgetsPerFrame);
+        }
+        fmt::print("\n  ]\n}}\n");
+    }
+} // !namespace
+
+int main(int argc, char * argv[]) try
+{
+    auto const options = parseOptions(argc, argv);
+    if (options.screen.empty())
+        runMicroBenchmarks(options);
+    else
+        runScreen(options);
+}
+catch (std::exception const & e)
+{
+    spdlog::critical(Core::formatExceptionStack(e));
+    return EXIT_FAILURE;
+}
@@ -9,7 +9,12 @@
     CONSTANT(unsigned int, gameViewWidth,  820);                                   \
     CONSTANT(unsigned int, gameViewHeight, 615);                                   \
     CONSTANT(float,        gameViewRatio,  (float)gameViewWidth / gameViewHeight); \
-    CONSTANT(unsigned int, fontSize,       8);
+    CONSTANT(unsigned int, fontSize,       8);                                     \
+    CONSTANT(float,        textOutline,    1.f);                                   \
+    CONSTANT(unsigned int, tickRate,       60);                                    \
+    CONSTANT(unsigned int, maxTicksPerFrame, 5);                                   \
+    CONSTANT(float,        mapWidth,       21'000.f);                              \
+    CONSTANT(float,        mapHeight,      13'100.f);
 
 // -------------------------------------------------------------------------------------------------
 
@@ -9,7 +9,7 @@
 
 // C++ includes
 #include <exception>
-#include <filesystem>
+#include <string_view>
 #include <vector>
 
 namespace Core
@@ -29,16 +29,33 @@ namespace Core
         std::throw_with_nested(Exception(std::move(str), std::forward<Args>(args)...));
     }
 
+    /// Where an error was raised: see SOURCE_CONTEXT
+    struct SourceContext
+    {
+        std::string_view file; ///< Stem only
+        int              line;
+    };
+
+    /// "src/core/Exception.hpp" -> "Exception"
+    consteval auto fileStem(std::string_view path) -> std::string_view
+    {
+        auto const slash = path.find_last_of("/\\");
+        auto const name  = slash == std::string_view::npos ? path : path.substr(slash + 1);
+        return name.substr(0, name.rfind('.'));
+    }
+
+/// The current SourceContext, built at compile time
+#define SOURCE_CONTEXT (Core::SourceContext{ Core::fileStem(__FILE__), __LINE__ })
+
     template<typename... Args>
-    [[noreturn]] inline void throwWithNested(int line, std::string const & src,
-                                             fmt::format_string<Args...> str, Args &&... args)
+    [[noreturn]] inline void throwWithNested(SourceContext where, fmt::format_string<Args...> str,
+                                             Args &&... args)
     {
         auto const msg = fmt::format(std::move(str), std::forward<Args>(args)...);
-        std::throw_with_nested(Exception("{} [{}:{}]", msg, src, line));
+        std::throw_with_nested(Exception("{} [{}:{}]", msg, where.file, where.line));
     }
 
-#define THROW_NESTED(...) \
-    Core::throwWithNested(__LINE__, std::filesystem::path(__FILE__).stem().string(), __VA_ARGS__)
+#define THROW_NESTED(...) Core::throwWithNested(SOURCE_CONTEXT, __VA_ARGS__)
 
     /// Boolean assert: Throws an error formatted with @p format and @p args if @p expr is false
     template<typename... Args>
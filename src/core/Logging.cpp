@@ -0,0 +1,70 @@
+/// @file   Logging.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "Logging.hpp"
+
+// Project includes
+#include "Exception.hpp"
+
+// Third-party includes
+#include <spdlog/async.h>
+#include <spdlog/cfg/env.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+#include <spdlog/spdlog.h>
+
+// C++ includes
+#include <chrono>
+#include <memory>
+#include <utility>
+
+using namespace Core;
+
+namespace
+{
+    /// Messages, about 1 MB: a burst of a few thousand is absorbed, beyond the oldest are dropped
+    constexpr std::size_t queueSize = 8'192;
+
+    auto const flushPeriod = std::chrono::seconds(1);
+
+    constexpr auto pattern = "%C-%m-%d %H:%M:%S.%e [%t] [%^%L%$] %v";
+
+    /// Owned here rather than by spdlog's registry, to be joined when AsyncLogging is destroyed
+    std::shared_ptr<spdlog::details::thread_pool> pool;
+} // !namespace
+
+auto Core::parseLogLevel(std::string_view name) -> spdlog::level::level_enum
+{
+    auto const level = spdlog::level::from_str(std::string(name));
+    Core::bAssert(level != spdlog::level::off || name == "off", "Unknown log level '{}'", name);
+    return level;
+}
+
+AsyncLogging::AsyncLogging(std::string name)
+{
+    pool = std::make_shared<spdlog::details::thread_pool>(queueSize, 1);
+
+    auto const sink   = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+    auto const logger = std::make_shared<spdlog::async_logger>(
+        std::move(name), sink, pool, spdlog::async_overflow_policy::overrun_oldest);
+    logger->flush_on(spdlog::level::warn);
+
+    spdlog::set_default_logger(logger);
+    spdlog::set_pattern(pattern);
+    spdlog::set_level(static_cast<spdlog::level::level_enum>(SPDLOG_ACTIVE_LEVEL));
+    spdlog::cfg::load_env_levels();
+    spdlog::flush_every(flushPeriod);
+}
+
+AsyncLogging::~AsyncLogging()
+{
+    auto const async = spdlog::default_logger();
+    auto const sync  = std::make_shared<spdlog::logger>(async->name(), async->sinks().begin(),
+                                                        async->sinks().end());
+    sync->set_level(async->level());
+    sync->flush_on(spdlog::level::warn);
+    spdlog::set_default_logger(sync);
+
+    // The logging thread writes what's left in the queue before it is joined
+    pool.reset();
+}
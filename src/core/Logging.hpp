@@ -0,0 +1,41 @@
+/// @file   Logging.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Trace and debug messages go through SPDLOG_TRACE and SPDLOG_DEBUG, never spdlog::trace() and
+/// spdlog::debug(): below SPDLOG_ACTIVE_LEVEL (info in Release builds, see CMakeLists.txt), the
+/// macros compile to nothing, arguments included.
+
+#pragma once
+
+// Third-party includes
+#include <spdlog/common.h>
+
+// C++ includes
+#include <string>
+#include <string_view>
+
+namespace Core
+{
+    class AsyncLogging;
+
+    /// "trace", "debug", "info", "warning", "error", "critical" or "off". Throws otherwise.
+    [[nodiscard]] auto parseLogLevel(std::string_view name) -> spdlog::level::level_enum;
+}
+
+/// While alive, spdlog's default logger only queues messages: a logging thread formats and writes
+/// them, so that logging never blocks the caller on the console. The queue is bounded and drops
+/// its oldest messages when full rather than wait. A flush is queued every second, and after
+/// every warning or worse.
+/// The level starts at SPDLOG_ACTIVE_LEVEL, then follows the SPDLOG_LEVEL environment variable
+/// (e.g. SPDLOG_LEVEL=debug), if set.
+class Core::AsyncLogging final
+{
+public:
+    explicit AsyncLogging(std::string name);
+    /// Writes the queued messages. Messages logged afterwards are written synchronously.
+    ~AsyncLogging();
+
+    AsyncLogging(AsyncLogging const &)             = delete;
+    AsyncLogging & operator=(AsyncLogging const &) = delete;
+};
@@ -0,0 +1,256 @@
+/// @file   Profiler.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "Profiler.hpp"
+
+// Project includes
+#include "Exception.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <new>
+
+using namespace Core;
+
+namespace
+{
+    constexpr std::size_t zoneCapacity  = 1 << 14; // Per thread
+    constexpr std::size_t frameCapacity = 1 << 9;
+
+    /// Single-writer ring. Readers copy it without locking, then drop what the writer may have
+    /// been overwriting meanwhile.
+    template<typename T, std::size_t Capacity>
+    struct Ring
+    {
+        std::array<T, Capacity>    items{};
+        std::atomic<std::uint64_t> head = 0; ///< Number of items ever pushed
+
+        void push(T const & item) noexcept
+        {
+            auto const h = head.load(std::memory_order_relaxed);
+            items[h % Capacity] = item;
+            head.store(h + 1, std::memory_order_release);
+        }
+
+        void copyTo(std::vector<T> & out) const
+        {
+            auto const last  = head.load(std::memory_order_acquire);
+            auto const first = last > Capacity ? last - Capacity : 0;
+            auto const start = out.size();
+            for (auto i = first; i < last; ++i)
+                out.push_back(items[i % Capacity]);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            auto const now       = head.load(std::memory_order_relaxed);
+            auto const firstSafe = now + 1 > Capacity ? now + 1 - Capacity : 0;
+            auto const torn      = std::min(std::max(firstSafe, first) - first, last - first);
+            out.erase(out.begin() + static_cast<std::ptrdiff_t>(start),
+                      out.begin() + static_cast<std::ptrdiff_t>(start + torn));
+        }
+    };
+
+    using ZoneRing = Ring<Profiler::Zone, zoneCapacity>;
+
+    struct ThreadRing
+    {
+        std::string               name;
+        std::uint32_t             index = 0;
+        std::uint32_t             depth = 0; ///< Owner only
+        std::unique_ptr<ZoneRing> zones;     ///< Hundreds of KB: only made by a first zone
+    };
+
+    // Constant-initialized: operator new may run before any dynamic initialization
+    constinit std::atomic<std::uint64_t> drawCalls      = 0;
+    constinit std::atomic<std::uint64_t> allocations    = 0;
+    constinit std::atomic<std::uint64_t> allocatedBytes = 0;
+    constinit std::atomic<std::uint64_t> rebuiltWidgets = 0;
+
+    struct Registry
+    {
+        std::mutex                           mutex; // Only taken to add threads and read names
+        std::deque<ThreadRing>               threads;
+        Ring<Profiler::Frame, frameCapacity> frames;
+    };
+
+    auto registry() -> Registry &
+    {
+        static Registry instance;
+        return instance;
+    }
+
+    auto threadRing() -> ThreadRing &
+    {
+        thread_local ThreadRing * ring = nullptr;
+        if (!ring)
+        {
+            auto & [mutex, threads, frames] = registry();
+            std::scoped_lock const lock(mutex);
+
+            auto const index = static_cast<std::uint32_t>(threads.size());
+            ring = &threads.emplace_back();
+            ring->name  = fmt::format("Thread {}", index);
+            ring->index = index;
+        }
+        return *ring;
+    }
+} // !namespace
+
+Profiler::ScopedZone::ScopedZone(char const * name) noexcept : _name(name), _begin(Clock::now())
+{
+    ++threadRing().depth;
+}
+
+Profiler::ScopedZone::~ScopedZone() noexcept
+{
+    auto & ring = threadRing();
+    --ring.depth;
+    if (!ring.zones) [[unlikely]]
+    {
+        std::scoped_lock const lock(registry().mutex); // Set while readers may iterate
+        ring.zones = std::make_unique<ZoneRing>();
+    }
+    ring.zones->push({ _name, _begin, Clock::now(), ring.index, ring.depth });
+}
+
+void Profiler::nameThread(std::string name)
+{
+    auto & ring = threadRing();
+    std::scoped_lock const lock(registry().mutex);
+    ring.name = std::move(name);
+}
+
+#ifdef DARKORBIT_PROFILING
+void Profiler::countDrawCalls(std::size_t count) noexcept
+{
+    drawCalls.fetch_add(count, std::memory_order_relaxed);
+}
+
+void Profiler::countRebuiltWidgets(std::size_t count) noexcept
+{
+    rebuiltWidgets.fetch_add(count, std::memory_order_relaxed);
+}
+#endif
+
+auto Profiler::counters() noexcept -> Counters
+{
+    return {
+        drawCalls     .load(std::memory_order_relaxed),
+        allocations   .load(std::memory_order_relaxed),
+        allocatedBytes.load(std::memory_order_relaxed),
+        rebuiltWidgets.load(std::memory_order_relaxed)
+    };
+}
+
+void Profiler::markFrame() noexcept
+{
+    // Render thread only
+    static auto     last     = Clock::now();
+    static Counters previous = counters();
+
+    auto const now     = Clock::now();
+    auto const current = counters();
+
+    registry().frames.push({
+        std::chrono::duration<float, std::milli>(now - last).count(),
+        static_cast<std::uint32_t>(current.drawCalls   - previous.drawCalls),
+        static_cast<std::uint32_t>(current.allocations - previous.allocations),
+        current.allocatedBytes - previous.allocatedBytes,
+        static_cast<std::uint32_t>(current.rebuiltWidgets - previous.rebuiltWidgets)
+    });
+
+    last     = now;
+    previous = current;
+}
+
+auto Profiler::frames() -> std::vector<Frame>
+{
+    std::vector<Frame> result;
+    result.reserve(frameCapacity);
+    registry().frames.copyTo(result);
+    return result;
+}
+
+auto Profiler::zones() -> std::vector<Zone>
+{
+    auto & [mutex, threads, frames] = registry();
+
+    std::vector<Zone> result;
+    std::scoped_lock const lock(mutex); // Keeps threads from being added while iterating
+    for (auto && thread : threads)
+    {
+        if (thread.zones)
+            thread.zones->copyTo(result);
+    }
+    return result;
+}
+
+auto Profiler::threadNames() -> std::vector<std::string>
+{
+    auto & [mutex, threads, frames] = registry();
+
+    std::vector<std::string> result;
+    std::scoped_lock const lock(mutex);
+    for (auto && thread : threads)
+        result.push_back(thread.name);
+    return result;
+}
+
+void Profiler::exportChromeTrace(std::filesystem::path const & path)
+{
+    auto const zones = Profiler::zones();
+    auto const names = threadNames();
+
+    std::ofstream file(path);
+    Core::bAssert(file.is_open(), "Failed to open trace file {}", path.string());
+
+    auto const origin = zones.empty() ? Clock::time_point() : std::min_element(
+        zones.begin(), zones.end(), [](auto & lhs, auto & rhs) { return lhs.begin < rhs.begin; }
+    )->begin;
+    auto const microseconds = [](auto duration) {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    };
+
+    file << R"({"displayTimeUnit":"ms","traceEvents":[)";
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+        file << fmt::format(R"({}{{"name":"thread_name","ph":"M","pid":1,"tid":{},)"
+                            R"("args":{{"name":"{}"}}}})", i ? ",\n" : "\n", i, names[i]);
+    }
+    for (auto && zone : zones)
+    {
+        file << fmt::format(",\n" R"({{"name":"{}","ph":"X","pid":1,"tid":{},"ts":{:.3f},)"
+                            R"("dur":{:.3f}}})", zone.name, zone.thread,
+                            microseconds(zone.begin - origin), microseconds(zone.end - zone.begin));
+    }
+    file << "\n]}\n";
+
+    Core::bAssert(file.good(), "Failed to write trace file {}", path.string());
+}
+
+#ifdef DARKORBIT_PROFILING
+// Counts every heap allocation of the process
+auto operator new(std::size_t size) -> void *
+{
+    allocations   .fetch_add(1,    std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (auto * const ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+auto operator new[](std::size_t size) -> void * { return ::operator new(size); }
+
+void operator delete  (void * ptr)              noexcept { std::free(ptr); }
+void operator delete[](void * ptr)              noexcept { std::free(ptr); }
+void operator delete  (void * ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void * ptr, std::size_t) noexcept { std::free(ptr); }
+#endif
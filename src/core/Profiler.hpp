@@ -0,0 +1,105 @@
+/// @file   Profiler.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// C++ includes
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+/// Frame profiler. Zones and counters only exist in DARKORBIT_PROFILING builds; frame times are
+/// always recorded. Each thread writes its own lock-free ring, any thread can read them all.
+namespace Core::Profiler
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Zone
+    {
+        char const *      name;   ///< String literal
+        Clock::time_point begin;
+        Clock::time_point end;
+        std::uint32_t     thread; ///< Index in threadNames()
+        std::uint32_t     depth;  ///< Number of enclosing zones on the same thread
+    };
+
+    struct Frame
+    {
+        float         milliseconds;
+        std::uint32_t drawCalls;
+        std::uint32_t allocations;
+        std::uint64_t allocatedBytes;
+        std::uint32_t rebuiltWidgets;
+    };
+
+    struct Counters
+    {
+        std::uint64_t drawCalls;
+        std::uint64_t allocations;
+        std::uint64_t allocatedBytes;
+        std::uint64_t rebuiltWidgets;
+    };
+
+    /// Scoped zone: use PROFILE_ZONE rather than this
+    class ScopedZone
+    {
+    private:
+        char const *      _name;
+        Clock::time_point _begin;
+
+    public:
+        explicit ScopedZone(char const * name) noexcept;
+        ~ScopedZone() noexcept;
+
+        ScopedZone(ScopedZone const &)             = delete;
+        ScopedZone & operator=(ScopedZone const &) = delete;
+    };
+
+    /// Names the calling thread in the overlay and in traces
+    void nameThread(std::string name);
+
+    /// Accounts for draw calls issued during the current frame
+    void countDrawCalls(std::size_t count = 1) noexcept;
+
+    /// Accounts for HUD widgets re-laid-out for the frame being published: 0 on a static frame
+    void countRebuiltWidgets(std::size_t count) noexcept;
+
+    /// Totals since startup, all threads included. Always 0 without DARKORBIT_PROFILING.
+    [[nodiscard]] auto counters() noexcept -> Counters;
+
+    /// Render thread: closes the current frame, with the counters accumulated since the last one
+    void markFrame() noexcept;
+
+    /// Last frames, oldest first
+    [[nodiscard]] auto frames() -> std::vector<Frame>;
+    /// Zones still in the rings of every thread, each thread's oldest first
+    [[nodiscard]] auto zones() -> std::vector<Zone>;
+    [[nodiscard]] auto threadNames() -> std::vector<std::string>;
+
+    /// Writes zones() to @p path in the Chrome trace event format (chrome://tracing, Perfetto)
+    void exportChromeTrace(std::filesystem::path const & path);
+
+    [[nodiscard]] constexpr auto enabled() noexcept -> bool
+    {
+#ifdef DARKORBIT_PROFILING
+        return true;
+#else
+        return false;
+#endif
+    }
+} // !namespace Core::Profiler
+
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b)      PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef DARKORBIT_PROFILING
+# define PROFILE_ZONE(name) \
+    Core::Profiler::ScopedZone const PROFILE_CONCAT(profileZone, __LINE__)(name)
+#else
+# define PROFILE_ZONE(name) static_cast<void>(0)
+inline void Core::Profiler::countDrawCalls(std::size_t) noexcept {}
+inline void Core::Profiler::countRebuiltWidgets(std::size_t) noexcept {}
+#endif
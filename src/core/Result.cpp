@@ -0,0 +1,52 @@
+/// @file   Result.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "Result.hpp"
+
+using namespace Core;
+
+namespace
+{
+    auto formatAt(SourceContext where, fmt::string_view format, fmt::format_args args)
+        -> std::string
+    {
+        return fmt::format("{} [{}:{}]", fmt::vformat(format, args), where.file, where.line);
+    }
+
+    /// Throws @p stack[i] with the rest of the stack nested in it
+    [[noreturn]] void raiseFrom(ExceptionStack const & stack, std::size_t i)
+    {
+        if (i + 1 == stack.size())
+            throw Exception("{}", stack[i]);
+
+        try
+        {
+            raiseFrom(stack, i + 1);
+        }
+        catch (...)
+        {
+            std::throw_with_nested(Exception("{}", stack[i]));
+        }
+    }
+} // !namespace
+
+auto Core::vmakeError(SourceContext where, fmt::string_view format, fmt::format_args args) -> Error
+{
+    return Error(formatAt(where, format, args));
+}
+
+Error::Error(std::string message)
+    : _stack{ std::move(message) }
+{
+}
+
+void Error::raise() const
+{
+    raiseFrom(_stack, 0);
+}
+
+void Error::prepend(SourceContext where, fmt::string_view format, fmt::format_args args)
+{
+    _stack.insert(_stack.begin(), formatAt(where, format, args));
+}
@@ -0,0 +1,159 @@
+/// @file   Result.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Error handling for hot paths: a Result carries either a value or an Error, and failing is a
+/// branch rather than a throw. Building the Error is out of line, so the success path only pays
+/// for a flag test. Callers that can afford exceptions turn an Error into the same nested
+/// exceptions THROW_NESTED would have raised with value() or Error::raise().
+///
+///     auto find(Id id) -> Core::Result<Item>
+///     {
+///         if (!known(id)) [[unlikely]]
+///             return MAKE_ERROR("Unknown item {}", id);
+///         return items[id];
+///     }
+
+#pragma once
+
+// Project includes
+#include "Exception.hpp"
+
+// C++ includes
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+
+namespace Core
+{
+    class Error;
+
+    template<typename T>
+    class Result;
+
+    /// Out of line, cold: formats "message [file:line]", as THROW_NESTED does
+    [[nodiscard]] auto vmakeError(SourceContext where, fmt::string_view format,
+                                  fmt::format_args args) -> Error;
+
+    template<typename... Args>
+    [[nodiscard]] auto makeError(SourceContext where, fmt::format_string<Args...> str,
+                                 Args &&... args) -> Error;
+} // !namespace Core
+
+/// Error for a Result, raised at the current SourceContext
+#define MAKE_ERROR(...) Core::makeError(SOURCE_CONTEXT, __VA_ARGS__)
+
+/// What went wrong, outermost context first: the messages of the exception stack THROW_NESTED
+/// would have built
+class Core::Error final
+{
+private:
+    ExceptionStack _stack;
+
+public:
+    explicit Error(std::string message);
+
+public:
+    /// This error within what the caller was doing, as THROW_NESTED does around a rethrow
+    template<typename... Args>
+    [[nodiscard]] auto wrap(SourceContext where, fmt::format_string<Args...> str,
+                            Args &&... args) const -> Error;
+
+    /// Throws the equivalent nested Core::Exception
+    [[noreturn]] void raise() const;
+
+public:
+    [[nodiscard]] auto stack() const -> ExceptionStack const & { return _stack; }
+
+    /// Same text as formatExceptionStack() on the exception raise() throws
+    [[nodiscard]] auto format() const -> std::string { return formatExceptionStack(_stack); }
+
+private:
+    void prepend(SourceContext where, fmt::string_view format, fmt::format_args args);
+};
+
+/// Value of type @p T, or the Error that prevented computing it
+template<typename T>
+class [[nodiscard]] Core::Result final
+{
+private:
+    std::variant<T, Error> _value;
+
+public:
+    Result(T value)     : _value(std::in_place_index<0>, std::move(value)) {} // NOLINT
+    Result(Error error) : _value(std::in_place_index<1>, std::move(error)) {} // NOLINT
+
+public:
+    [[nodiscard]] auto ok() const noexcept -> bool { return _value.index() == 0; }
+    explicit operator bool() const noexcept        { return ok();                }
+
+    /// Unchecked: ok() must be true
+    [[nodiscard]] auto operator*()  const noexcept -> T const & { return *std::get_if<0>(&_value); }
+    [[nodiscard]] auto operator->() const noexcept -> T const * { return std::get_if<0>(&_value); }
+
+    /// The value, or raises the error
+    [[nodiscard]] auto value() const & -> T const &;
+    [[nodiscard]] auto value() &&      -> T;
+
+    /// ok() must be false
+    [[nodiscard]] auto error() const noexcept -> Error const & { return *std::get_if<1>(&_value); }
+};
+
+/// Success or an Error
+template<>
+class [[nodiscard]] Core::Result<void> final
+{
+private:
+    std::optional<Error> _error;
+
+public:
+    Result() = default;
+    Result(Error error) : _error(std::move(error)) {} // NOLINT
+
+public:
+    [[nodiscard]] auto ok() const noexcept -> bool { return !_error; }
+    explicit operator bool() const noexcept        { return ok();    }
+
+    /// Raises the error, if any
+    void value() const
+    {
+        if (_error) [[unlikely]]
+            _error->raise();
+    }
+
+    /// ok() must be false
+    [[nodiscard]] auto error() const noexcept -> Error const & { return *_error; }
+};
+
+template<typename... Args>
+inline auto Core::makeError(SourceContext where, fmt::format_string<Args...> str,
+                            Args &&... args) -> Error
+{
+    return vmakeError(where, str, fmt::make_format_args(args...));
+}
+
+template<typename... Args>
+inline auto Core::Error::wrap(SourceContext where, fmt::format_string<Args...> str,
+                              Args &&... args) const -> Error
+{
+    auto wrapped = *this;
+    wrapped.prepend(where, str, fmt::make_format_args(args...));
+    return wrapped;
+}
+
+template<typename T>
+inline auto Core::Result<T>::value() const & -> T const &
+{
+    if (!ok()) [[unlikely]]
+        error().raise();
+    return **this;
+}
+
+template<typename T>
+inline auto Core::Result<T>::value() && -> T
+{
+    if (!ok()) [[unlikely]]
+        error().raise();
+    return std::move(*std::get_if<0>(&_value));
+}
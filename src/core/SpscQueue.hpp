@@ -0,0 +1,60 @@
+/// @file   SpscQueue.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// C++ includes
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+namespace Core
+{
+    template<typename T, std::size_t Capacity>
+    class SpscQueue;
+} // !namespace Core
+
+/// Bounded lock-free FIFO from one producer thread to one consumer thread. Neither side ever
+/// waits: push() fails when the queue is full, pop() when it's empty.
+template<typename T, std::size_t Capacity>
+class Core::SpscQueue
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+
+private:
+    // Apart, so that both sides don't keep stealing the same cache line from each other
+    static constexpr std::size_t cacheLine = 64;
+
+    std::array<T, Capacity>                     _slots{};
+    alignas(cacheLine) std::atomic<std::size_t> _head{ 0 }; ///< Next slot to pop, consumer-owned
+    alignas(cacheLine) std::atomic<std::size_t> _tail{ 0 }; ///< Next slot to push, producer-owned
+
+public:
+    /// Producer: false if the queue is full
+    auto push(T value) -> bool
+    {
+        auto const tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _head.load(std::memory_order_acquire) == Capacity)
+            return false;
+
+        _slots[tail & (Capacity - 1)] = std::move(value);
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer: oldest value, if any
+    auto pop() -> std::optional<T>
+    {
+        auto const head = _head.load(std::memory_order_relaxed);
+        if (head == _tail.load(std::memory_order_acquire))
+            return std::nullopt;
+
+        std::optional<T> value(std::move(_slots[head & (Capacity - 1)]));
+        _head.store(head + 1, std::memory_order_release);
+        return value;
+    }
+};
@@ -0,0 +1,29 @@
+/// @file   StringHash.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// C++ includes
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Core
+{
+    /// Transparent hash: lets string-keyed maps be searched with a std::string_view or a literal
+    /// without building a temporary std::string
+    struct StringHash
+    {
+        using is_transparent = void;
+
+        auto operator()(std::string_view str) const noexcept -> std::size_t
+        {
+            return std::hash<std::string_view>{}(str);
+        }
+    };
+
+    template<typename T>
+    using StringMap = std::unordered_map<std::string, T, StringHash, std::equal_to<>>;
+} // !namespace Core
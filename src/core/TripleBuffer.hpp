@@ -0,0 +1,52 @@
+/// @file   TripleBuffer.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// C++ includes
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace Core
+{
+    template<typename T>
+    class TripleBuffer;
+} // !namespace Core
+
+/// Lock-free hand-over of the latest value from one producer thread to one consumer thread.
+/// Neither side ever waits: the producer fills its own slot while the consumer reads its own,
+/// and they swap through the third one.
+template<typename T>
+class Core::TripleBuffer
+{
+private:
+    static constexpr std::uint8_t indexMask = 0b011;
+    static constexpr std::uint8_t freshBit  = 0b100; ///< Set when the middle slot wasn't read yet
+
+private:
+    std::array<T, 3>          _slots{};
+    std::atomic<std::uint8_t> _middle{ 1 };
+    std::uint8_t              _back  = 0; ///< Producer only
+    std::uint8_t              _front = 2; ///< Consumer only
+
+public:
+    /// Producer: slot to fill. It holds what was published two or three times ago.
+    [[nodiscard]] auto back() noexcept -> T & { return _slots[_back]; }
+
+    /// Producer: makes back() the latest value
+    void publish() noexcept
+    {
+        auto const middle = _middle.exchange(_back | freshBit, std::memory_order_acq_rel);
+        _back = middle & indexMask;
+    }
+
+    /// Consumer: latest published value, or the same as last time if nothing new was published
+    [[nodiscard]] auto acquire() noexcept -> T const &
+    {
+        if (_middle.load(std::memory_order_relaxed) & freshBit)
+            _front = _middle.exchange(_front, std::memory_order_acq_rel) & indexMask;
+        return _slots[_front];
+    }
+};
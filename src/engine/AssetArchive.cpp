@@ -0,0 +1,135 @@
+/// @file   AssetArchive.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "AssetArchive.hpp"
+
+// Project includes
+#include "../core/Exception.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+using namespace Engine;
+
+AssetArchive::~AssetArchive()
+{
+    unmount();
+}
+
+auto AssetArchive::mount(std::filesystem::path const & path) -> bool
+{
+    unmount();
+    if (!std::filesystem::exists(path))
+        return false;
+
+    try
+    {
+        map(path);
+        index();
+    }
+    catch (...)
+    {
+        unmount();
+        THROW_NESTED("Failed to mount asset archive {}", path.string());
+    }
+    return true;
+}
+
+void AssetArchive::unmount()
+{
+    _entries.clear();
+#ifdef _WIN32
+    if (_data)    UnmapViewOfFile(_data);
+    if (_mapping) CloseHandle(_mapping);
+    if (_file)    CloseHandle(_file);
+    _file = _mapping = nullptr;
+#else
+    if (_data) munmap(_data, _size);
+#endif
+    _data = nullptr;
+    _size = 0;
+}
+
+auto AssetArchive::find(std::string_view path) const -> Entry const *
+{
+    auto const it = _entries.find(path);
+    return it != _entries.end() ? &it->second : nullptr;
+}
+
+void AssetArchive::map(std::filesystem::path const & path)
+{
+    _size = static_cast<std::size_t>(std::filesystem::file_size(path));
+    Core::bAssert(_size >= sizeof(Archive::Header), "Truncated archive");
+
+#ifdef _WIN32
+    _file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (_file == INVALID_HANDLE_VALUE)
+        _file = nullptr;
+    Core::bAssert(_file != nullptr, "CreateFile failed ({})", GetLastError());
+
+    _mapping = CreateFileMappingW(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    Core::bAssert(_mapping != nullptr, "CreateFileMapping failed ({})", GetLastError());
+
+    _data = MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+    Core::bAssert(_data != nullptr, "MapViewOfFile failed ({})", GetLastError());
+#else
+    auto const fd = open(path.c_str(), O_RDONLY);
+    Core::bAssert(fd >= 0, "open() failed: {}", std::strerror(errno));
+
+    auto * const data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping keeps the file open
+    Core::bAssert(data != MAP_FAILED, "mmap() failed: {}", std::strerror(errno));
+    _data = data;
+#endif
+}
+
+void AssetArchive::index()
+{
+    auto const * const bytes = static_cast<std::byte const *>(_data);
+
+    Archive::Header header; // NOLINT
+    std::memcpy(&header, bytes, sizeof(header));
+    Core::bAssert(std::equal(std::begin(header.magic), std::end(header.magic),
+                             std::begin(Archive::magic)), "Not an asset archive");
+    Core::bAssert(header.version == Archive::version,
+                  "Unsupported archive version {}", header.version);
+
+    auto const recordsSize = std::size_t(header.entryCount) * sizeof(Archive::EntryRecord);
+    auto const namesOffset = sizeof(Archive::Header) + recordsSize;
+    Core::bAssert(namesOffset + header.namesSize <= _size, "Truncated archive index");
+
+    auto const * const names = reinterpret_cast<char const *>(bytes + namesOffset);
+    _entries.reserve(header.entryCount);
+
+    for (std::uint32_t i = 0; i < header.entryCount; ++i)
+    {
+        Archive::EntryRecord record; // NOLINT
+        std::memcpy(&record, bytes + sizeof(header) + i * sizeof(record), sizeof(record));
+
+        Core::bAssert(std::size_t(record.nameOffset) + record.nameSize <= header.namesSize
+                      && record.offset <= _size && record.size <= _size - record.offset,
+                      "Corrupted archive entry {}", i);
+        Core::bAssert(record.type != Archive::Type::Image
+                      || record.size == std::uint64_t(record.width) * record.height * 4,
+                      "Corrupted archive image {}", i);
+
+        std::string_view const name(names + record.nameOffset, record.nameSize);
+        _entries.insert_or_assign(name, Entry{
+            record.type, record.width, record.height,
+            { bytes + record.offset, static_cast<std::size_t>(record.size) }
+        });
+    }
+}
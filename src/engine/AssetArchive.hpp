@@ -0,0 +1,104 @@
+/// @file   AssetArchive.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// C++ includes
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+
+namespace Engine
+{
+    class AssetArchive;
+
+    /// On-disk layout, written by the DarkOrbitPack tool:
+    /// Header | EntryRecord[entryCount] | names | payloads (each aligned on payloadAlignment)
+    namespace Archive
+    {
+        constexpr char          magic[4]         = { 'D', 'O', 'P', 'K' };
+        constexpr std::uint32_t version          = 1;
+        constexpr std::size_t   payloadAlignment = 16;
+
+        enum class Type : std::uint32_t
+        {
+            Raw   = 0, ///< Stored as is
+            Image = 1, ///< Decoded to 8-bit RGBA, width * height * 4 bytes
+        };
+
+        struct Header
+        {
+            char          magic[4];
+            std::uint32_t version;
+            std::uint32_t entryCount;
+            std::uint32_t namesSize;
+        };
+
+        struct EntryRecord
+        {
+            std::uint64_t offset; ///< From the start of the archive
+            std::uint64_t size;
+            std::uint32_t nameOffset; ///< From the start of the names
+            std::uint32_t nameSize;
+            Type          type;
+            std::uint32_t width;
+            std::uint32_t height;
+            std::uint32_t reserved;
+        };
+
+        static_assert(std::endian::native == std::endian::little, "Archives are little-endian");
+        static_assert(sizeof(Header) == 16 && sizeof(EntryRecord) == 40, "Unexpected padding");
+    } // !namespace Archive
+} // !namespace Engine
+
+/// Read-only, memory-mapped asset archive. Entries point straight into the mapping.
+class Engine::AssetArchive
+{
+public:
+    struct Entry
+    {
+        Archive::Type              type;
+        unsigned                   width;
+        unsigned                   height;
+        std::span<std::byte const> data;
+    };
+
+private:
+    void *      _data = nullptr;
+    std::size_t _size = 0;
+#ifdef _WIN32
+    void *      _file    = nullptr;
+    void *      _mapping = nullptr;
+#endif
+
+    /// Keys point into the mapping
+    std::unordered_map<std::string_view, Entry> _entries;
+
+public:
+    AssetArchive() noexcept = default;
+    ~AssetArchive();
+
+public:
+    AssetArchive(AssetArchive const &)             = delete;
+    AssetArchive & operator=(AssetArchive const &) = delete;
+
+public:
+    /// Maps @p path. Returns false if it doesn't exist, throws if it isn't a valid archive.
+    auto mount(std::filesystem::path const & path) -> bool;
+    void unmount();
+
+public:
+    /// @p path as given to the packer, e.g. "assets/favicon.png"
+    [[nodiscard]] auto find(std::string_view path) const -> Entry const *;
+    [[nodiscard]] auto mounted() const -> bool        { return _data != nullptr; }
+    [[nodiscard]] auto size()    const -> std::size_t { return _entries.size(); }
+
+private:
+    void map(std::filesystem::path const & path);
+    void index();
+};
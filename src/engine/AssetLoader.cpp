@@ -0,0 +1,222 @@
+/// @file   AssetLoader.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "AssetLoader.hpp"
+
+// Project includes
+#include "AssetArchive.hpp"
+#include "../core/Exception.hpp"
+#include "../core/Profiler.hpp"
+
+// Third-party includes
+#include <fmt/chrono.h>
+#include <spdlog/spdlog.h>
+
+// C++ includes
+#include <algorithm>
+#include <type_traits>
+
+using namespace Engine;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    auto since(Clock::time_point start) -> AssetLoader::Duration
+    {
+        return std::chrono::duration_cast<AssetLoader::Duration>(Clock::now() - start);
+    }
+
+    /// Calls @p f and stores how long it took in @p duration
+    template<typename F>
+    auto timed(F && f, AssetLoader::Duration & duration)
+    {
+        auto const start = Clock::now();
+        if constexpr (std::is_void_v<std::invoke_result_t<F>>)
+        {
+            f();
+            duration = since(start);
+        }
+        else
+        {
+            auto result = f();
+            duration = since(start);
+            return result;
+        }
+    }
+} // !namespace
+
+AssetLoader::AssetLoader(AssetArchive const & archive, unsigned workers) : _archive(archive)
+{
+    _workers.reserve(workers);
+    for (unsigned i = 0; i < workers; ++i)
+        _workers.emplace_back([this](std::stop_token const & stop) { work(stop); });
+}
+
+void AssetLoader::enqueue(std::string name, Job job)
+{
+    if (idle())
+        _timings.clear(); // A new load starts, e.g. a hot reload
+
+    auto const id = _queued++;
+    _pending.insert(id);
+    {
+        std::scoped_lock const lock(_mutex);
+        _tasks.push_back({ id, std::move(name), std::move(job) });
+    }
+    _wakeUp.notify_one();
+}
+
+void AssetLoader::then(std::string name, Finish step)
+{
+    _barriers.push_back({ std::move(name), _queued++, std::move(step) });
+
+    Failure failure;
+    runBarriers(failure); // Nothing may be pending
+    rethrow(failure);
+}
+
+void AssetLoader::pump()
+{
+    std::vector<Done> done;
+    {
+        std::scoped_lock const lock(_mutex);
+        done.swap(_done);
+    }
+
+    // The whole batch is finished even if one failed: the others and the barriers waiting
+    // on them must not be left pending
+    Failure failure;
+    for (auto && [id, name, finish, work, error] : done)
+    {
+        _pending.erase(id);
+        ++_finished;
+
+        Duration finished{};
+        if (!error && finish)
+        {
+            try
+            {
+                timed(finish, finished);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+        }
+
+        if (error)
+        {
+            if (!failure.error)
+                failure = { error, std::move(name) };
+            continue;
+        }
+
+        SPDLOG_TRACE("[Assets] {} loaded: {} on a worker, {} finishing", name, work, finished);
+        _timings.push_back({ std::move(name), work, finished });
+    }
+
+    runBarriers(failure);
+    rethrow(failure);
+}
+
+void AssetLoader::upload(Finish step)
+{
+    if (_uploader)
+        _uploader(std::move(step));
+    else
+        step();
+}
+
+auto AssetLoader::exists(std::filesystem::path const & path) const -> bool
+{
+    return _archive.find(path.generic_string()) || std::filesystem::exists(path);
+}
+
+auto AssetLoader::progress() const -> float
+{
+    return _queued == 0 ? 1.f : static_cast<float>(_finished) / static_cast<float>(_queued);
+}
+
+auto AssetLoader::defaultWorkerCount() -> unsigned
+{
+    // Decoding is cheap next to disk access: past a few threads, the disk is the bottleneck
+    return std::clamp(std::thread::hardware_concurrency(), 1u, 4u);
+}
+
+void AssetLoader::work(std::stop_token const & stop)
+{
+    Core::Profiler::nameThread("Asset loader");
+
+    while (true)
+    {
+        Task task;
+        {
+            std::unique_lock lock(_mutex);
+            if (!_wakeUp.wait(lock, stop, [this] { return !_tasks.empty(); })
+                || stop.stop_requested())
+            {
+                return;
+            }
+
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+
+        Done done{ task.id, std::move(task.name), {}, {}, {} };
+        try
+        {
+            PROFILE_ZONE("Asset job");
+            done.finish = timed(task.job, done.work);
+        }
+        catch (...)
+        {
+            done.error = std::current_exception();
+        }
+
+        std::scoped_lock const lock(_mutex);
+        _done.push_back(std::move(done));
+    }
+}
+
+void AssetLoader::runBarriers(Failure & failure)
+{
+    while (!_barriers.empty()
+           && (_pending.empty() || *_pending.begin() > _barriers.front().id))
+    {
+        auto barrier = std::move(_barriers.front());
+        _barriers.pop_front();
+        ++_finished; // Even if it throws: idle() must become true again
+
+        Duration duration{};
+        try
+        {
+            timed(barrier.step, duration);
+        }
+        catch (...)
+        {
+            if (!failure.error)
+                failure = { std::current_exception(), std::move(barrier.name) };
+            continue;
+        }
+
+        SPDLOG_TRACE("[Assets] {} done in {}", barrier.name, duration);
+        _timings.push_back({ std::move(barrier.name), {}, duration });
+    }
+}
+
+void AssetLoader::rethrow(Failure const & failure)
+{
+    if (!failure.error)
+        return;
+
+    try
+    {
+        std::rethrow_exception(failure.error);
+    }
+    catch (...)
+    {
+        THROW_NESTED("Failed to load asset '{}'", failure.name);
+    }
+}
@@ -0,0 +1,146 @@
+/// @file   AssetLoader.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// C++ includes
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Engine
+{
+    class AssetArchive;
+    class AssetLoader;
+} // !namespace Engine
+
+/// Runs file reads and decodes on a worker pool. What touches the main thread's state (packing,
+/// staging...) is handed back and only runs from pump(). GPU uploads go from there through
+/// upload(), to the thread drawing.
+class Engine::AssetLoader
+{
+public:
+    using Duration = std::chrono::microseconds;
+
+    /// Runs from pump(): stages results, and hands GPU work to upload()
+    using Finish   = std::function<void()>;
+    /// Runs on a worker and returns what's left to do from pump()
+    using Job      = std::function<Finish()>;
+    /// Runs GPU work on the thread drawing, between two frames
+    using Uploader = std::function<void(Finish)>;
+
+    struct Timing
+    {
+        std::string name;
+        Duration    work;   ///< Spent on a worker: read + decode
+        Duration    finish; ///< Spent in pump(): staging, packing; uploads only when run inline
+    };
+
+private:
+    struct Task
+    {
+        std::size_t id;
+        std::string name;
+        Job         job;
+    };
+
+    struct Done
+    {
+        std::size_t        id;
+        std::string        name;
+        Finish             finish;
+        Duration           work;
+        std::exception_ptr error;
+    };
+
+    struct Barrier
+    {
+        std::string name;
+        std::size_t id;    ///< Every job enqueued before must be finished first
+        Finish      step;
+    };
+
+    /// First error of a batch, rethrown once the whole batch ran
+    struct Failure
+    {
+        std::exception_ptr error;
+        std::string        name;
+    };
+
+private:
+    AssetArchive const & _archive;
+
+    std::mutex                  _mutex;
+    std::condition_variable_any _wakeUp;
+    std::deque<Task>            _tasks;
+    std::vector<Done>           _done;
+
+    // Only touched by the thread calling pump()
+    std::deque<Barrier>   _barriers;
+    std::set<std::size_t> _pending; ///< Ids of the unfinished jobs
+    std::vector<Timing>   _timings;
+    Uploader              _uploader;
+    std::size_t           _queued   = 0;
+    std::size_t           _finished = 0;
+
+    std::vector<std::jthread> _workers; // Last: joined before the rest is destroyed
+
+public:
+    explicit AssetLoader(AssetArchive const & archive, unsigned workers = defaultWorkerCount());
+
+public:
+    AssetLoader(AssetLoader const &)             = delete;
+    AssetLoader & operator=(AssetLoader const &) = delete;
+
+public:
+    void enqueue(std::string name, Job job);
+
+    /// Runs @p step from pump() once every job enqueued so far is finished, or right away if
+    /// none is pending: it then rethrows what @p step threw
+    void then(std::string name, Finish step);
+
+    /// Hands GPU work @p step to the uploader, e.g. Engine::Renderer::upload(). Runs it right
+    /// away until one is set: before the renderer exists, or without one.
+    void upload(Finish step);
+    void setUploader(Uploader uploader) { _uploader = std::move(uploader); }
+
+    /// Runs the finish steps of the completed jobs, then the barriers they were holding back.
+    /// Rethrows the first error of a failed job, finish step or barrier, once all of them ran.
+    void pump();
+
+public:
+    /// Mounted archive, if any: its entries are already decoded and don't need a job
+    [[nodiscard]] auto archive() const -> AssetArchive const & { return _archive; }
+
+    /// Whether @p path is in the archive or on disk
+    [[nodiscard]] auto exists(std::filesystem::path const & path) const -> bool;
+
+public:
+    /// Ratio of finished jobs and steps, 1 when idle
+    [[nodiscard]] auto progress() const -> float;
+    [[nodiscard]] auto idle()     const -> bool { return _finished == _queued; }
+    /// Of the last load: cleared when a job is enqueued while idle
+    [[nodiscard]] auto timings()  const -> std::vector<Timing> const & { return _timings; }
+
+    [[nodiscard]] static auto defaultWorkerCount() -> unsigned;
+
+private:
+    void work(std::stop_token const & stop);
+    /// Runs the barriers no pending job holds back. They all count as finished: the first to
+    /// throw is kept in @p failure.
+    void runBarriers(Failure & failure);
+
+    /// Rethrows the error of @p failure, if any, nested in which asset failed
+    static void rethrow(Failure const & failure);
+};
@@ -0,0 +1,204 @@
+/// @file   FileWatcher.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "FileWatcher.hpp"
+
+// Project includes
+#include "../core/Exception.hpp"
+#include "../core/Profiler.hpp"
+
+// third-party includes
+#include <spdlog/spdlog.h>
+
+// C++ includes
+#include <algorithm>
+#include <chrono>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#ifdef __linux__
+# include <cerrno>
+# include <cstring>
+# include <poll.h>
+# include <sys/inotify.h>
+# include <unistd.h>
+#else
+# include <condition_variable>
+#endif
+
+using namespace Engine;
+
+namespace
+{
+#ifdef __linux__
+    /// How long the watcher may take to notice it must stop
+    constexpr auto stopLatency = std::chrono::milliseconds(100);
+#else
+    constexpr auto scanPeriod  = std::chrono::milliseconds(250);
+#endif
+} // !namespace
+
+FileWatcher::FileWatcher(std::filesystem::path root)
+    : _root(std::move(root))
+    , _thread([this](std::stop_token stop) { watch(stop); })
+{
+}
+
+auto FileWatcher::poll() -> std::vector<std::filesystem::path>
+{
+    std::scoped_lock const lock(_mutex);
+    return std::exchange(_changed, {});
+}
+
+void FileWatcher::push(std::filesystem::path const & path)
+{
+    std::filesystem::path generic = path.generic_string();
+
+    std::scoped_lock const lock(_mutex);
+    if (std::find(_changed.begin(), _changed.end(), generic) == _changed.end())
+        _changed.push_back(std::move(generic));
+}
+
+#ifdef __linux__
+void FileWatcher::watch(std::stop_token const & stop) try
+{
+    Core::Profiler::nameThread("File watcher");
+
+    struct Descriptor
+    {
+        int fd;
+        ~Descriptor() { if (fd >= 0) ::close(fd); }
+    } const inotify{ ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC) };
+    Core::bAssert(inotify.fd >= 0, "inotify_init1 failed: {}", std::strerror(errno));
+
+    // inotify isn't recursive: one watch per directory
+    std::unordered_map<int, std::filesystem::path> directories; // By watch descriptor
+    auto const watchTree = [&](std::filesystem::path const & root, bool report) {
+        auto const add = [&](std::filesystem::path const & directory) {
+            auto const wd = ::inotify_add_watch(inotify.fd, directory.c_str(),
+                                                IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE
+                                                | IN_ONLYDIR);
+            if (wd >= 0)
+                directories.insert_or_assign(wd, directory);
+            else if (errno != ENOENT) // Already gone: skipped below as well
+                spdlog::warn("[FileWatcher] Can't watch {}: {}", directory.generic_string(),
+                             std::strerror(errno));
+        };
+
+        // Walked by hand, so that a directory gone meanwhile, e.g. an editor's temporary one,
+        // is skipped rather than ending the walk
+        std::vector<std::filesystem::path> pending{ root };
+        while (!pending.empty())
+        {
+            auto const directory = std::move(pending.back());
+            pending.pop_back();
+
+            add(directory); // Before listing it: nothing created meanwhile is missed
+            std::error_code error;
+            for (std::filesystem::directory_iterator it(directory, error), end;
+                 !error && it != end; it.increment(error))
+            {
+                std::error_code gone; // This entry only
+                if (!it->is_symlink(gone) && it->is_directory(gone))
+                    pending.push_back(it->path());
+                else if (report && !gone)
+                    push(it->path());
+            }
+            if (error)
+                SPDLOG_DEBUG("[FileWatcher] Skipped {}: {}", directory.generic_string(),
+                             error.message());
+        }
+    };
+    watchTree(_root, false);
+    spdlog::info("[FileWatcher] Watching {} ({} directories)", _root.generic_string(),
+                 directories.size());
+
+    alignas(inotify_event) char buffer[4096];
+    while (!stop.stop_requested())
+    {
+        pollfd ready{ inotify.fd, POLLIN, 0 };
+        auto const timeout = static_cast<int>(stopLatency.count());
+        if (::poll(&ready, 1, timeout) <= 0)
+            continue;
+
+        auto const size = ::read(inotify.fd, buffer, sizeof(buffer));
+        for (ssize_t offset = 0; offset < size; )
+        {
+            auto const & event = *reinterpret_cast<inotify_event const *>(buffer + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event.len);
+
+            if (event.mask & IN_Q_OVERFLOW)
+            {
+                // Events were dropped: anything may have changed, so everything is reported
+                spdlog::warn("[FileWatcher] Event queue overflowed, reloading all of {}",
+                             _root.generic_string());
+                watchTree(_root, true);
+                continue;
+            }
+
+            auto const it = directories.find(event.wd);
+            if (event.len == 0 || it == directories.end())
+                continue;
+
+            auto const path = it->second / event.name;
+            if (event.mask & IN_ISDIR)
+                watchTree(path, true); // Created or moved in: its files are new too
+            else if (event.mask & (IN_CLOSE_WRITE | IN_MOVED_TO))
+                push(path); // Saved in place, or written aside then renamed over
+        }
+    }
+}
+catch (std::exception const & e)
+{
+    spdlog::warn("[FileWatcher] Stopped watching {}: {}", _root.generic_string(),
+                 Core::formatExceptionStack(e));
+}
+#else
+void FileWatcher::watch(std::stop_token const & stop) try
+{
+    Core::Profiler::nameThread("File watcher");
+
+    std::unordered_map<std::string, std::filesystem::file_time_type> times; // By path
+    auto const scan = [&] {
+        // Files and directories may vanish mid-scan: the rest is seen by the next one
+        std::error_code error;
+        for (std::filesystem::recursive_directory_iterator
+                 entry(_root, std::filesystem::directory_options::skip_permission_denied, error),
+                 end;
+             !error && entry != end; entry.increment(error))
+        {
+            std::error_code gone; // This entry only
+            if (!entry->is_regular_file(gone))
+                continue;
+
+            auto const time = entry->last_write_time(gone);
+            if (gone)
+                continue;
+
+            auto const [it, added] = times.try_emplace(entry->path().generic_string(), time);
+            if (!added && std::exchange(it->second, time) != time)
+                push(entry->path());
+        }
+    };
+    scan();
+    spdlog::info("[FileWatcher] Polling {} ({} files)", _root.generic_string(), times.size());
+
+    std::mutex                  mutex;
+    std::condition_variable_any wakeUp; // Only by a stop request
+    while (true)
+    {
+        std::unique_lock lock(mutex);
+        static_cast<void>(wakeUp.wait_for(lock, stop, scanPeriod, [] { return false; }));
+        if (stop.stop_requested())
+            break;
+        scan();
+    }
+}
+catch (std::exception const & e)
+{
+    spdlog::warn("[FileWatcher] Stopped watching {}: {}", _root.generic_string(),
+                 Core::formatExceptionStack(e));
+}
+#endif
@@ -0,0 +1,43 @@
+/// @file   FileWatcher.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// C++ includes
+#include <filesystem>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace Engine { class FileWatcher; }
+
+/// Reports the files written under a directory tree, watched from a background thread: with
+/// inotify on Linux, by polling modification times elsewhere. Directories created later are
+/// watched too. Watching stops, with a warning, if the tree can't be watched.
+class Engine::FileWatcher final
+{
+private:
+    std::filesystem::path              _root;
+    std::mutex                         _mutex;
+    std::vector<std::filesystem::path> _changed; ///< Since the last poll(), each once
+
+    std::jthread _thread; // Last: joined before the rest is destroyed
+
+public:
+    explicit FileWatcher(std::filesystem::path root);
+
+public:
+    FileWatcher(FileWatcher const &)             = delete;
+    FileWatcher & operator=(FileWatcher const &) = delete;
+
+public:
+    /// Files written since the last call, as <root>/<relative path> with '/' separators: the
+    /// paths assets are loaded with when root is relative
+    [[nodiscard]] auto poll() -> std::vector<std::filesystem::path>;
+
+private:
+    void watch(std::stop_token const & stop);
+    void push(std::filesystem::path const & path);
+};
@@ -0,0 +1,39 @@
+/// @file   FixedTimestep.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "FixedTimestep.hpp"
+
+// C++ includes
+#include <algorithm>
+
+using namespace Engine;
+
+FixedTimestep::FixedTimestep(unsigned ticksPerSecond, unsigned maxTicks) noexcept
+    : _tick(sf::microseconds(1'000'000 / std::max(ticksPerSecond, 1u)))
+    , _maxTicks(std::max(maxTicks, 1u))
+{
+}
+
+auto FixedTimestep::advance(sf::Time elapsed) noexcept -> unsigned
+{
+    _accumulator += elapsed;
+
+    auto ticks = static_cast<unsigned>(_accumulator.asMicroseconds() / _tick.asMicroseconds());
+    if (ticks > _maxTicks)
+    {
+        // Keep the fractional part so alpha stays continuous
+        auto const excess = _tick * static_cast<sf::Int64>(ticks - _maxTicks);
+        _accumulator -= excess;
+        _dropped     += excess;
+        ticks = _maxTicks;
+    }
+
+    _accumulator -= _tick * static_cast<sf::Int64>(ticks);
+    return ticks;
+}
+
+auto FixedTimestep::alpha() const noexcept -> float
+{
+    return _accumulator / _tick;
+}
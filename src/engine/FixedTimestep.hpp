@@ -0,0 +1,39 @@
+/// @file   FixedTimestep.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// third-party includes
+#include <SFML/System/Time.hpp>
+
+namespace Engine
+{
+    class FixedTimestep;
+} // !namespace Engine
+
+/// Turns variable frame times into a whole number of fixed simulation ticks
+class Engine::FixedTimestep
+{
+private:
+    sf::Time _tick;
+    unsigned _maxTicks;
+    sf::Time _accumulator = sf::Time::Zero;
+    sf::Time _dropped     = sf::Time::Zero;
+
+public:
+    /// @param maxTicks Catch-up cap: past it, the simulation slows down instead of spiralling
+    FixedTimestep(unsigned ticksPerSecond, unsigned maxTicks) noexcept;
+
+public:
+    /// Accumulates @p elapsed and returns the number of ticks to simulate this frame
+    [[nodiscard]] auto advance(sf::Time elapsed) noexcept -> unsigned;
+
+public:
+    [[nodiscard]] auto tick()    const noexcept -> sf::Time { return _tick;    }
+    [[nodiscard]] auto untilNextTick() const noexcept -> sf::Time { return _tick - _accumulator; }
+    /// Simulated time thrown away by the catch-up cap so far
+    [[nodiscard]] auto dropped() const noexcept -> sf::Time { return _dropped; }
+    /// How far the frame is between the last tick and the next one, in [0, 1)
+    [[nodiscard]] auto alpha()   const noexcept -> float;
+};
@@ -0,0 +1,211 @@
+/// @file   FontManager.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "FontManager.hpp"
+
+// Project includes
+#include "AssetArchive.hpp"
+#include "AssetLoader.hpp"
+#include "../core/Exception.hpp"
+
+// third-party includes
+#include <SFML/Graphics/Text.hpp>
+#include <spdlog/spdlog.h>
+
+// C++ includes
+#include <algorithm>
+#include <utility>
+
+using namespace Engine;
+
+namespace
+{
+    /// Same glyphs as FontManager::prewarm(), untracked: for a font nothing draws with yet
+    void rasterize(sf::Font const & font, unsigned characterSize,
+                   std::vector<float> const & outlines)
+    {
+        for (auto const outline : outlines)
+        {
+            for (auto c = FontManager::firstPrewarmed; c <= FontManager::lastPrewarmed; ++c)
+                font.getGlyph(c, characterSize, false, outline);
+        }
+    }
+} // !namespace
+
+auto FontManager::load(std::string name, std::filesystem::path const & path) -> sf::Font &
+{
+    auto font = std::make_shared<sf::Font>();
+    Core::bAssert(font->loadFromFile(path.string()),
+                  "Failed to load font '{}' from {}", name, path.string());
+    return *_fonts.insert_or_assign(std::move(name), Font{ std::move(font), path, {} })
+        .first->second.font;
+}
+
+auto FontManager::load(std::string name, std::filesystem::path const & path,
+                       AssetArchive const & archive) -> sf::Font &
+{
+    auto const * const entry = archive.find(path.generic_string());
+    if (!entry)
+        return load(std::move(name), path);
+
+    // sf::Font reads from the mapping for as long as it lives: the archive must outlive it
+    auto font = std::make_shared<sf::Font>();
+    Core::bAssert(font->loadFromMemory(entry->data.data(), entry->data.size()),
+                  "Failed to load font '{}' from archive entry {}", name, path.generic_string());
+    return *_fonts.insert_or_assign(std::move(name), Font{ std::move(font), {}, {} })
+        .first->second.font;
+}
+
+void FontManager::prewarm(std::string const & name, unsigned characterSize,
+                          std::initializer_list<float> outlines)
+{
+    Core::bAssert(_fonts.contains(name), "No font loaded for '{}'", name);
+    auto & entry = _fonts.at(name);
+    prewarm(*entry.font, entry.prewarmed.emplace_back(Prewarmed{ characterSize, outlines }));
+}
+
+void FontManager::prewarm(sf::Font const & font, Prewarmed const & glyphs)
+{
+    for (auto const outline : glyphs.outlines)
+    {
+        for (auto c = firstPrewarmed; c <= lastPrewarmed; ++c)
+        {
+            font.getGlyph(c, glyphs.characterSize, false, outline);
+            track(font, c, glyphs.characterSize, outline);
+        }
+    }
+    static_cast<void>(takeRasterizedGlyphs()); // Warm-up doesn't count
+}
+
+auto FontManager::reload(std::filesystem::path const & path, AssetLoader & loader) -> bool
+{
+    auto reloaded = false;
+    for (auto && [name, entry] : _fonts)
+    {
+        if (entry.path.empty() || entry.path.generic_string() != path.generic_string())
+            continue;
+        reloaded = true;
+
+        loader.enqueue(path.generic_string(),
+                       [this, name, path, &loader,
+                        prewarmed = entry.prewarmed]() -> AssetLoader::Finish {
+            auto font = std::make_shared<sf::Font>();
+            if (!font->loadFromFile(path.string()))
+            {
+                // Likely read mid-write: the end of the write triggers another reload
+                spdlog::warn("[FontManager] Failed to reload font '{}' from {}", name,
+                             path.generic_string());
+                return [] {};
+            }
+
+            return [this, name, font = std::move(font), prewarmed, &loader] {
+                // Rasterizing creates and fills the glyph pages: GPU work, as texture uploads.
+                // The font is swapped in by update() once it's done.
+                auto const rasterized = std::make_shared<std::atomic<bool>>(false);
+                _reloads.push_back({ name, font, rasterized });
+                loader.upload([font, prewarmed, rasterized] {
+                    for (auto const & glyphs : prewarmed)
+                        rasterize(*font, glyphs.characterSize, glyphs.outlines);
+                    rasterized->store(true, std::memory_order_release);
+                });
+            };
+        });
+    }
+    return reloaded;
+}
+
+void FontManager::update()
+{
+    std::erase_if(_reloads, [this](Reload const & reload) {
+        if (!reload.rasterized->load(std::memory_order_acquire))
+            return false;
+
+        // The previous font stays alive for the frames still drawing it
+        auto & entry = _fonts.at(reload.name);
+        _retired.push_back({ std::exchange(entry.font, reload.font), 0 });
+        for (auto const & glyphs : entry.prewarmed)
+            prewarm(*entry.font, glyphs); // Already rasterized: only tracks them
+        ++_version;
+        spdlog::info("[FontManager] Reloaded font '{}'", reload.name);
+        return true;
+    });
+}
+
+void FontManager::release(std::uint64_t published, std::uint64_t reached)
+{
+    for (auto && retired : _retired)
+    {
+        if (retired.fence == 0)
+            retired.fence = published;
+    }
+
+    std::erase_if(_retired, [&](Retired const & retired) {
+        if (retired.fence > reached)
+            return false;
+
+#ifdef DARKORBIT_PROFILING
+        // Another font may be allocated at the same address
+        std::erase_if(_glyphs, [font = retired.font.get()](GlyphKey const & glyph) {
+            return std::get<0>(glyph) == font;
+        });
+#endif
+        return true;
+    });
+}
+
+auto FontManager::font(std::string const & name) const -> sf::Font const &
+{
+    Core::bAssert(_fonts.contains(name), "No font loaded for '{}'", name);
+    return *_fonts.at(name).font;
+}
+
+auto FontManager::prewarmed(sf::Text const & text) const -> bool
+{
+    if (text.getStyle() & sf::Text::Bold)
+        return false;
+
+    auto const entry = std::find_if(_fonts.begin(), _fonts.end(), [&](auto const & pair) {
+        return pair.second.font.get() == text.getFont();
+    });
+    if (entry == _fonts.end())
+        return false;
+
+    auto const outline = text.getOutlineThickness();
+    return std::ranges::any_of(entry->second.prewarmed, [&](Prewarmed const & glyphs) {
+        auto const has = [&](float thickness) {
+            return std::ranges::find(glyphs.outlines, thickness) != glyphs.outlines.end();
+        };
+        return glyphs.characterSize == text.getCharacterSize() && has(0.f) && has(outline);
+    });
+}
+
+#ifdef DARKORBIT_PROFILING
+void FontManager::track(sf::Text const & text) const
+{
+    auto const * font = text.getFont();
+    if (!font)
+        return;
+
+    bool const outlined = text.getOutlineThickness() != 0.f;
+    for (auto const c : text.getString())
+    {
+        // sf::Text draws the fill glyph, then the outline glyph on top of it
+        track(*font, c, text.getCharacterSize(), 0.f);
+        if (outlined)
+            track(*font, c, text.getCharacterSize(), text.getOutlineThickness());
+    }
+}
+
+void FontManager::track(sf::Font const & font, std::uint32_t codePoint, unsigned size,
+                        float outline) const
+{
+    if (_glyphs.emplace(&font, size, outline, codePoint).second)
+        ++_rasterizedGlyphs;
+}
+
+auto FontManager::takeRasterizedGlyphs() -> std::size_t
+{
+    return _rasterizedGlyphs.exchange(0);
+}
+#endif
@@ -0,0 +1,139 @@
+/// @file   FontManager.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// third-party includes
+#include <SFML/Graphics/Font.hpp>
+
+// C++ includes
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#ifdef DARKORBIT_PROFILING
+# include <set>
+# include <tuple>
+#endif
+
+namespace sf { class Text; }
+
+namespace Engine
+{
+    class AssetArchive;
+    class AssetLoader;
+    class FontManager;
+} // !namespace Engine
+
+/// Owns the fonts. Returned references stay valid until the font is reloaded: the previous one
+/// is kept until release() says no frame left to draw uses it, so texts must be remade with the
+/// new one before the next publish. sf::Font isn't thread-safe: text shared between threads
+/// relies on pre-warmed glyphs.
+class Engine::FontManager
+{
+private:
+    struct Prewarmed
+    {
+        unsigned           characterSize;
+        std::vector<float> outlines;
+    };
+
+    // shared_ptr: a reload hands it through copyable loader steps
+    struct Font
+    {
+        std::shared_ptr<sf::Font> font;
+        std::filesystem::path     path;     ///< Empty if read from the archive: never reloaded
+        std::vector<Prewarmed>    prewarmed;
+    };
+
+    struct Reload
+    {
+        std::string                        name;
+        std::shared_ptr<sf::Font>          font;
+        std::shared_ptr<std::atomic<bool>> rasterized; ///< By the upload, wherever it ran
+    };
+
+    struct Retired
+    {
+        std::shared_ptr<sf::Font> font;
+        std::uint64_t             fence; ///< Destroyed once release() reaches it, 0 until known
+    };
+
+private:
+    std::unordered_map<std::string, Font> _fonts;
+    std::vector<Reload>                   _reloads; ///< Loaded, not swapped in yet
+    std::vector<Retired>                  _retired; ///< Replaced, maybe still drawn
+    std::size_t                           _version = 0;
+
+#ifdef DARKORBIT_PROFILING
+    // Mirrors the glyph cache of sf::Font: a glyph is rasterized the first time it is requested.
+    // Tracked where text geometry is built, taken from the simulation thread.
+    using GlyphKey = std::tuple<sf::Font const *, unsigned, float, std::uint32_t>;
+
+    mutable std::set<GlyphKey>       _glyphs;
+    mutable std::atomic<std::size_t> _rasterizedGlyphs = 0;
+#endif
+
+public:
+    /// Code points rasterized by prewarm(): printable ASCII
+    static constexpr std::uint32_t firstPrewarmed = 0x20;
+    static constexpr std::uint32_t lastPrewarmed  = 0x7E;
+
+public:
+    auto load(std::string name, std::filesystem::path const & path) -> sf::Font &;
+    /// Reads the font from @p archive when it's there, without copying it
+    auto load(std::string name, std::filesystem::path const & path, AssetArchive const & archive)
+        -> sf::Font &;
+
+    /// Rasterizes the printable ASCII glyphs of @p name for each outline thickness of @p outlines
+    void prewarm(std::string const & name, unsigned characterSize,
+                 std::initializer_list<float> outlines = { 0.f });
+
+    /// Loads again the fonts read from @p path on a worker of @p loader, then pre-warms them
+    /// through the loader's uploader as they were. update() swaps them in once that's done. On
+    /// failure, logged, they're kept as they are.
+    /// @return Whether a font was loaded from @p path
+    auto reload(std::filesystem::path const & path, AssetLoader & loader) -> bool;
+
+    /// Swaps in the reloaded fonts whose glyphs are rasterized: texts must then be remade
+    void update();
+
+    /// Destroys the fonts replaced before frame @p published once @p reached passes it, as
+    /// Engine::ScreenManager::release() does. Called right after publishing: the screens had
+    /// remade their texts with the new fonts.
+    void release(std::uint64_t published, std::uint64_t reached);
+
+public:
+    [[nodiscard]] auto font(std::string const & name) const -> sf::Font const &;
+
+    /// Whether prewarm() rasterized every glyph @p text may request: its font, character size
+    /// and outline thickness, not bold, each with the fill glyphs its advances come from.
+    /// Only the code points are left to check.
+    [[nodiscard]] auto prewarmed(sf::Text const & text) const -> bool;
+
+    /// Changes whenever reload() replaced a font: texts must be made again to use it
+    [[nodiscard]] auto version() const -> std::size_t { return _version; }
+
+public:
+    /// Accounts for the glyphs @p text needs. No-op unless built with DARKORBIT_PROFILING.
+    void track(sf::Text const & text) const;
+
+    /// Returns the number of glyphs rasterized since the last call
+    [[nodiscard]] auto takeRasterizedGlyphs() -> std::size_t;
+
+private:
+    void prewarm(sf::Font const & font, Prewarmed const & glyphs);
+
+    void track(sf::Font const & font, std::uint32_t codePoint, unsigned size, float outline) const;
+};
+
+#ifndef DARKORBIT_PROFILING
+inline void Engine::FontManager::track(sf::Text const &) const {}
+inline void Engine::FontManager::track(sf::Font const &, std::uint32_t, unsigned, float) const {}
+inline auto Engine::FontManager::takeRasterizedGlyphs() -> std::size_t { return 0; }
+#endif
@@ -0,0 +1,148 @@
+/// @file   Hud.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "Hud.hpp"
+
+// Project includes
+#include "FontManager.hpp"
+#include "../core/Profiler.hpp"
+#include "../core/Result.hpp"
+
+// third-party includes
+#include <SFML/Graphics/RenderTarget.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <utility>
+
+using namespace Engine;
+
+auto Hud::add(sf::Sprite sprite) -> sf::Sprite &
+{
+    ++_version;
+    _spritesDirty = true;
+    return _sprites.emplace_back(std::move(sprite));
+}
+
+auto Hud::add(sf::Text text) -> sf::Text &
+{
+    ++_version;
+    _textsDirty = true;
+    return _texts.emplace_back(std::move(text));
+}
+
+void Hud::changed(sf::Text const & text)
+{
+    // A HUD's worth of texts: a scan is cheaper than a map, and doesn't allocate
+    std::size_t index = 0;
+    while (index < _texts.size() && &_texts[index] != &text)
+        ++index;
+    if (index == _texts.size()) [[unlikely]]
+        MAKE_ERROR("Changed text '{}' isn't in the HUD", text.getString().toAnsiString()).raise();
+
+    if (std::find(_changedTexts.begin(), _changedTexts.end(), index) == _changedTexts.end())
+        _changedTexts.push_back(index);
+}
+
+void Hud::refresh()
+{
+    PROFILE_ZONE("HUD refresh");
+
+    if (_spritesDirty)
+    {
+        _spriteBatch.clear();
+        for (auto && sprite : _sprites)
+            _spriteBatch.add(sprite);
+        _spritesDirty = false;
+        ++_spritesVersion;
+        ++_version;
+    }
+
+    if (_textsDirty)
+    {
+        _changedTexts.clear(); // All rebuilt
+        _textBatch.clear();
+        for (auto && text : _texts)
+        {
+            static_cast<void>(_textBatch.add(text, _fontManager));
+            _fontManager.track(text);
+        }
+        _textsDirty = false;
+        ++_version;
+    }
+
+    std::size_t relaidOut = 0;
+    for (auto && binding : _bindings)
+    {
+        if (binding.changed())
+        {
+            binding.layout();
+            ++relaidOut;
+        }
+    }
+    _rebuiltWidgets += relaidOut; // Every tick of the frame counts
+
+    // Only the glyphs of the texts the layouts marked are rebuilt, if they did change
+    auto rebuilt = false;
+    for (auto const i : _changedTexts)
+    {
+        if (_textBatch.update(i, _texts[i], _fontManager))
+        {
+            _fontManager.track(_texts[i]);
+            rebuilt = true;
+        }
+    }
+    _changedTexts.clear();
+
+    if (relaidOut > 0 || rebuilt)
+        ++_version;
+}
+
+void Hud::publish()
+{
+    PROFILE_ZONE("HUD publish");
+    Core::Profiler::countRebuiltWidgets(std::exchange(_rebuiltWidgets, 0));
+
+    auto & frame = _frames.back();
+    if (frame.version != _version)
+    {
+        if (frame.spritesVersion != _spritesVersion)
+        {
+            frame.sprites        = _spriteBatch;
+            frame.spritesVersion = _spritesVersion;
+        }
+
+        // Glyphs are laid out by refresh(): the render thread never touches the font
+        frame.texts.copyPagesFrom(_textBatch);
+        frame.version = _version;
+    }
+    _frames.publish();
+}
+
+void Hud::clear()
+{
+    _bindings.clear();
+    _texts   .clear();
+    _changedTexts.clear();
+    _sprites .clear();
+    _spriteBatch.clear();
+    _textBatch  .clear();
+    ++_spritesVersion;
+    _spritesDirty   = false;
+    _textsDirty     = false;
+    ++_version;
+}
+
+void Hud::draw(sf::RenderTarget & target, sf::RenderStates states) const
+{
+    auto const & frame = _frames.acquire();
+    {
+        PROFILE_ZONE("HUD sprites");
+        target.draw(frame.sprites, states);
+    }
+
+    // Draw text on top
+    PROFILE_ZONE("HUD texts");
+    target.draw(frame.texts, states);
+}
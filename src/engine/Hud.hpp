@@ -0,0 +1,124 @@
+/// @file   Hud.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// Project includes
+#include "SpriteBatch.hpp"
+#include "TextBatch.hpp"
+#include "../core/TripleBuffer.hpp"
+
+// third-party includes
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+// C++ includes
+#include <deque>
+#include <functional>
+#include <tuple>
+#include <vector>
+
+namespace Engine
+{
+    class FontManager;
+    class Hud;
+} // !namespace Engine
+
+/// Retained-mode HUD: widgets are built once, then only re-laid-out when a bound value changes.
+/// Widgets live on the simulation thread; draw() renders the last publish()ed copy of them.
+class Engine::Hud final : public sf::Drawable
+{
+private:
+    /// What the render thread draws. Only what changed is copied again: the sprites when they
+    /// were batched again, the text pages whose glyphs were rebuilt.
+    struct Frame
+    {
+        std::size_t version        = 0;
+        std::size_t spritesVersion = 0;
+        SpriteBatch sprites;
+        TextBatch   texts;
+    };
+
+    struct Binding
+    {
+        std::function<bool()> changed; ///< Compares bound fields with their last seen values
+        std::function<void()> layout;  ///< Rebuilds the widget(s) depending on those fields
+    };
+
+private:
+    FontManager const & _fontManager;
+
+    // deques keep references stable when widgets are added
+    std::deque<sf::Sprite>   _sprites;
+    std::deque<sf::Text>     _texts;
+    std::vector<Binding>     _bindings;
+    std::vector<std::size_t> _changedTexts; ///< Indices, each once, since the last refresh()
+    std::size_t              _rebuiltWidgets = 0; ///< By the refresh() calls since publish()
+
+    SpriteBatch _spriteBatch;
+    TextBatch   _textBatch;         ///< In _texts order
+    bool        _spritesDirty   = false;
+    bool        _textsDirty     = false;
+    std::size_t _version        = 1;
+    std::size_t _spritesVersion = 1; ///< Of _spriteBatch
+
+    mutable Core::TripleBuffer<Frame> _frames; // Consumed from draw()
+
+public:
+    explicit Hud(FontManager const & fontManager) noexcept : _fontManager(fontManager) {}
+
+public:
+    /// Sprites are static: changes made to them after the next refresh() aren't drawn.
+    /// Texts only follow the changes their bindings make.
+    auto add(sf::Sprite sprite) -> sf::Sprite &;
+    auto add(sf::Text   text)   -> sf::Text   &;
+
+    /// Runs @p layout now, then again on refresh() whenever one of @p fields changed.
+    /// @warning @p fields are captured by reference and must outlive the HUD.
+    template<typename... Fields>
+    void bind(std::function<void()> layout, Fields const &... fields);
+
+    /// Marks @p text, added before, for its glyphs to be rebuilt by the next refresh(): what a
+    /// binding or a layout changes must be, only those texts are looked at
+    void changed(sf::Text const & text);
+
+    /// Re-lays out the widgets whose bound fields changed since the last refresh, rebuilds the
+    /// glyphs of the texts marked changed, and batches the sprites and texts added since
+    void refresh();
+
+    /// Hands the current widgets over to draw(), and counts the widgets re-laid-out for them in
+    /// the profiler's rebuilt widgets
+    void publish();
+
+    void clear();
+
+public:
+    /// Changes whenever the widgets do
+    [[nodiscard]] auto version() const -> std::size_t { return _version; }
+
+private:
+    /// Render thread
+    void draw(sf::RenderTarget & target, sf::RenderStates states) const override;
+};
+
+template<typename... Fields>
+inline void Engine::Hud::bind(std::function<void()> layout, Fields const &... fields)
+{
+    static_assert(sizeof...(Fields) > 0, "A binding needs at least one field");
+
+    layout();
+    _bindings.push_back({
+        [&fields..., last = std::tuple(fields...)]() mutable
+        {
+            auto const current = std::tie(fields...);
+            if (current == last)
+                return false;
+
+            last = current;
+            return true;
+        },
+        std::move(layout)
+    });
+}
@@ -0,0 +1,248 @@
+/// @file   Layout.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "Layout.hpp"
+
+// Project includes
+#include "AssetArchive.hpp"
+#include "../core/Exception.hpp"
+#include "../core/Profiler.hpp"
+
+// third-party includes
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+// C++ includes
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+using namespace Engine;
+
+namespace
+{
+    constexpr std::array<std::string_view, 9> anchorNames = {
+        "top-left",    "top",    "top-right",
+        "left",        "center", "right",
+        "bottom-left", "bottom", "bottom-right",
+    };
+
+    /// Where @p anchor is in a box of @p size, from its top-left corner
+    auto point(sf::Vector2f size, Layout::Anchor anchor) -> sf::Vector2f
+    {
+        auto const index = static_cast<unsigned>(anchor);
+        return { size.x * static_cast<float>(index % 3) / 2.f,
+                 size.y * static_cast<float>(index / 3) / 2.f };
+    }
+} // !namespace
+
+Layout::Layout(sf::Vector2f screenSize)
+{
+    auto & root = _nodes.emplace_back();
+    root.name = "screen";
+    root.size = screenSize;
+    _ids.emplace(root.name, screen);
+}
+
+void Layout::load(std::filesystem::path const & path, AssetArchive const & archive) try
+{
+    if (auto const * const entry = archive.find(path.generic_string()))
+    {
+        std::istringstream stream(std::string(reinterpret_cast<char const *>(entry->data.data()),
+                                              entry->data.size()));
+        load(stream, path.generic_string());
+        return;
+    }
+
+    std::ifstream file(path);
+    Core::bAssert(file.is_open(), "Failed to open {}", path.string());
+    load(file, path.string());
+}
+catch (...)
+{
+    THROW_NESTED("Failed to load layout {}", path.generic_string());
+}
+
+void Layout::load(std::istream & stream, std::string_view name)
+{
+    _nodes.resize(1);
+    _nodes.front().dependents.clear();
+    _ids.clear();
+    _ids.emplace("screen", screen);
+
+    std::string line;
+    for (std::size_t number = 1; std::getline(stream, line); ++number)
+    {
+        line = line.substr(0, line.find('#'));
+
+        std::istringstream fields(line);
+        Node               node;
+        std::string        anchor, target, targetAnchor;
+        if (!(fields >> node.name))
+            continue; // Blank or comment
+
+        try
+        {
+            Core::bAssert(static_cast<bool>(fields >> anchor >> target >> targetAnchor),
+                          "Expected <node> <anchor> <target> <target anchor> [<dx> <dy>]");
+            if (fields >> node.offset.x)
+                Core::bAssert(static_cast<bool>(fields >> node.offset.y), "Missing dy");
+
+            auto const it = _ids.find(target);
+            Core::bAssert(it != _ids.end(), "Unknown target '{}': targets come first", target);
+            Core::bAssert(!_ids.contains(node.name), "Duplicate node '{}'", node.name);
+
+            node.anchor       = parseAnchor(anchor);
+            node.target       = it->second;
+            node.targetAnchor = parseAnchor(targetAnchor);
+        }
+        catch (...)
+        {
+            THROW_NESTED("Invalid node at {}:{}", name, number);
+        }
+
+        auto const id = _nodes.size();
+        _nodes[node.target].dependents.push_back(id);
+        _ids.emplace(node.name, id);
+        _nodes.push_back(std::move(node));
+    }
+}
+
+auto Layout::attach(std::string_view name, sf::Sprite & widget) -> NodeId
+{
+    return attach(name, Widget(&widget));
+}
+
+auto Layout::attach(std::string_view name, sf::Text & widget) -> NodeId
+{
+    return attach(name, Widget(&widget));
+}
+
+auto Layout::attach(std::string_view name, Widget widget) -> NodeId
+{
+    auto const id = node(name);
+    _nodes[id].widget = widget;
+    _nodes[id].size   = measure(widget);
+    return id;
+}
+
+void Layout::detach()
+{
+    for (auto && node : _nodes)
+        node.widget = std::monostate();
+    _placedTexts.clear();
+}
+
+void Layout::solve()
+{
+    PROFILE_ZONE("Layout solve");
+
+    // Declaration order puts every target before its dependents
+    for (auto it = std::next(_nodes.begin()); it != _nodes.end(); ++it)
+        place(*it);
+}
+
+void Layout::fit(NodeId id)
+{
+    auto & node = _nodes[id];
+    Core::bAssert(!std::holds_alternative<std::monostate>(node.widget),
+                  "Node '{}' has no widget to fit", node.name);
+
+    auto const size = measure(node.widget);
+    if (size == node.size)
+    {
+        place(node); // Same box, but a text's glyphs may sit differently in it
+        return;
+    }
+
+    node.size = size;
+    solve(id);
+}
+
+void Layout::resize(NodeId id, sf::Vector2f size)
+{
+    auto & node = _nodes[id];
+    Core::bAssert(std::holds_alternative<std::monostate>(node.widget),
+                  "Node '{}' is sized by its widget", node.name);
+    if (size == node.size)
+        return;
+
+    node.size = size;
+    if (id != screen)
+        solve(id);
+    else
+        solve();
+}
+
+void Layout::solve(NodeId id)
+{
+    PROFILE_ZONE("Layout solve");
+
+    _stack.assign(1, id);
+    while (!_stack.empty())
+    {
+        auto & node = _nodes[_stack.back()];
+        _stack.pop_back();
+
+        place(node);
+        _stack.insert(_stack.end(), node.dependents.rbegin(), node.dependents.rend());
+    }
+}
+
+void Layout::place(Node & node)
+{
+    auto const & target = _nodes[node.target];
+    node.position = target.position + point(target.size, node.targetAnchor) + node.offset
+                  - point(node.size, node.anchor);
+    ++_placed;
+
+    if (auto * const sprite = std::get_if<sf::Sprite *>(&node.widget))
+        (*sprite)->setPosition(node.position);
+    else if (auto * const text = std::get_if<sf::Text *>(&node.widget))
+    {
+        auto const bounds = (*text)->getLocalBounds();
+        (*text)->setOrigin(0.f, 0.f);
+        (*text)->setPosition(std::ceil(node.position.x - bounds.left),
+                             std::ceil(node.position.y - bounds.top));
+        _placedTexts.push_back(*text);
+    }
+}
+
+auto Layout::node(std::string_view name) const -> NodeId
+{
+    auto const it = _ids.find(name);
+    Core::bAssert(it != _ids.end(), "No layout node '{}'", name);
+    return it->second;
+}
+
+auto Layout::rect(NodeId id) const -> sf::FloatRect
+{
+    auto const & node = _nodes[id];
+    return { node.position, node.size };
+}
+
+auto Layout::parseAnchor(std::string_view name) -> Anchor
+{
+    for (std::size_t i = 0; i < anchorNames.size(); ++i)
+    {
+        if (anchorNames[i] == name)
+            return static_cast<Anchor>(i);
+    }
+    throw Core::Exception("Unknown anchor '{}'", name);
+}
+
+auto Layout::measure(Widget const & widget) -> sf::Vector2f
+{
+    auto const size = [](sf::FloatRect const & bounds) {
+        return sf::Vector2f(bounds.width, bounds.height);
+    };
+
+    if (auto const * const sprite = std::get_if<sf::Sprite *>(&widget))
+        return size((*sprite)->getGlobalBounds());
+    if (auto const * const text = std::get_if<sf::Text *>(&widget))
+        return size((*text)->getGlobalBounds());
+    return {};
+}
@@ -0,0 +1,136 @@
+/// @file   Layout.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// Project includes
+#include "../core/StringHash.hpp"
+
+// third-party includes
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+// C++ includes
+#include <cstdint>
+#include <filesystem>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace sf
+{
+    class Sprite;
+    class Text;
+} // !namespace sf
+
+namespace Engine
+{
+    class AssetArchive;
+    class Layout;
+} // !namespace Engine
+
+/// Anchor layout read from a data file: each node pins one of its anchors to an anchor of a node
+/// declared before it, or of the screen, plus an offset. Nodes are solved once, then only the
+/// ones anchored, directly or not, to a node whose size changed are solved again.
+///
+/// One node per line, `#` starts a comment:
+///     <node> <anchor> <target> <target anchor> [<dx> <dy>]
+/// Anchors: top-left, top, top-right, left, center, right, bottom-left, bottom, bottom-right.
+/// The target `screen` is the whole view.
+class Engine::Layout final
+{
+public:
+    using NodeId = std::size_t;
+
+    static constexpr NodeId screen = 0;
+
+    enum class Anchor : std::uint8_t
+    {
+        TopLeft,    Top,    TopRight,
+        Left,       Center, Right,
+        BottomLeft, Bottom, BottomRight,
+    };
+
+private:
+    /// Placed widget, if any: texts are placed by their bounds, as Utils::setTextPosition()
+    using Widget = std::variant<std::monostate, sf::Sprite *, sf::Text *>;
+
+    struct Node
+    {
+        std::string         name;
+        NodeId              target       = screen;
+        Anchor              anchor       = Anchor::TopLeft;
+        Anchor              targetAnchor = Anchor::TopLeft;
+        sf::Vector2f        offset;
+        sf::Vector2f        size;
+        sf::Vector2f        position;    ///< Of the top-left corner, once solved
+        std::vector<NodeId> dependents;  ///< Anchored to this node, in declaration order
+        Widget              widget;
+    };
+
+private:
+    std::vector<Node>       _nodes; ///< Screen first, then targets before their dependents
+    Core::StringMap<NodeId> _ids;
+    std::vector<NodeId>     _stack; // Reused by solve(NodeId)
+    std::vector<sf::Text *> _placedTexts; ///< Since the last takePlacedTexts()
+    std::size_t             _placed = 0;
+
+public:
+    explicit Layout(sf::Vector2f screenSize);
+
+public:
+    /// Replaces the nodes with those of @p path, read from @p archive when it's there
+    void load(std::filesystem::path const & path, AssetArchive const & archive);
+    void load(std::istream & stream, std::string_view name);
+
+    /// Places @p widget with the node @p name from now on, sized as it is
+    auto attach(std::string_view name, sf::Sprite & widget) -> NodeId;
+    auto attach(std::string_view name, sf::Text   & widget) -> NodeId;
+
+    /// Forgets every attached widget, e.g. before they're destroyed
+    void detach();
+
+    /// Solves every node
+    void solve();
+
+    /// Re-measures the widget of @p id after it changed. Only @p id is placed again if its size
+    /// didn't change, its dependents too otherwise.
+    void fit(NodeId id);
+
+    /// Sizes a node without widget, or the screen, and solves what depends on it
+    void resize(NodeId id, sf::Vector2f size);
+
+public:
+    [[nodiscard]] auto node(std::string_view name) const -> NodeId;
+    [[nodiscard]] auto rect(NodeId id)             const -> sf::FloatRect;
+
+    /// Nodes placed since the last call
+    [[nodiscard]] auto takePlaced() -> std::size_t { return std::exchange(_placed, 0); }
+
+    /// Calls @p f with each text widget placed since the last call, whose glyphs moved
+    template<typename F>
+    void takePlacedTexts(F && f);
+
+    [[nodiscard]] static auto parseAnchor(std::string_view name) -> Anchor;
+
+private:
+    auto attach(std::string_view name, Widget widget) -> NodeId;
+
+    /// Solves @p id, then everything depending on it
+    void solve(NodeId id);
+    void place(Node & node);
+
+    [[nodiscard]] static auto measure(Widget const & widget) -> sf::Vector2f;
+};
+
+template<typename F>
+inline void Engine::Layout::takePlacedTexts(F && f)
+{
+    for (auto * const text : _placedTexts)
+        f(*text);
+    _placedTexts.clear();
+}
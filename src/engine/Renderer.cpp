@@ -0,0 +1,225 @@
+/// @file   Renderer.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "Renderer.hpp"
+
+// Project includes
+#include "Screen.hpp"
+#include "Window.hpp"
+#include "../core/Exception.hpp"
+#include "../core/Profiler.hpp"
+
+// third-party includes
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/System/Clock.hpp>
+#include <spdlog/spdlog.h>
+
+// C++ includes
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+using namespace Engine;
+
+Renderer::Renderer(Window & window, bool logStats)
+    : _window(window)
+    , _logStats(logStats)
+{
+    Core::bAssert(_window.setActive(false), "Failed to release the window's GL context");
+    _thread = std::jthread([this](std::stop_token const & stop) { run(stop); });
+}
+
+void Renderer::publish() noexcept
+{
+    // Counted before publishing: whoever sees the count acquires that frame or a later one
+    if (_frames.back().dirty)
+        _dirtyFrames.fetch_add(1, std::memory_order_release);
+    else
+        _skippedFrames.fetch_add(1, std::memory_order_relaxed);
+
+    _frames.publish();
+    _published.fetch_add(1, std::memory_order_release);
+    notify();
+}
+
+void Renderer::upload(std::function<void()> step)
+{
+    {
+        std::scoped_lock const lock(_uploadMutex);
+        _uploads.push_back(std::move(step));
+    }
+    notify();
+}
+
+void Renderer::resize(sf::Vector2u size)
+{
+    upload([this, size] { _window.setSize(size); });
+}
+
+void Renderer::notify() noexcept
+{
+    _wakeUps.fetch_add(1, std::memory_order_release);
+    _wakeUps.notify_one();
+}
+
+void Renderer::check() const
+{
+    if (!_failed.load(std::memory_order_acquire))
+        return;
+
+    try
+    {
+        std::rethrow_exception(_error);
+    }
+    catch (...)
+    {
+        THROW_NESTED("Render thread stopped");
+    }
+}
+
+void Renderer::run(std::stop_token const & stop) try
+{
+    Core::Profiler::nameThread("Render");
+    Core::bAssert(_window.setActive(true), "Failed to activate the window on the render thread");
+
+    std::optional<sf::RenderTexture> offscreen; // Only while a post effect is active
+
+    sf::Clock     clock;
+    sf::Time      drawTime;
+    unsigned      frames  = 0;
+    std::uint64_t skipped = 0; ///< At the last stats
+
+    std::uint64_t woken     = 0;     // Wake-ups handled
+    std::uint64_t seen      = 0;     // Publishes acquired
+    std::uint64_t seenDirty = 0;     // Dirty ones among them
+    bool          animating = false; // Redrawn until the next publish, as it's extrapolated
+                                     // further into the tick every time
+    std::stop_callback const wake(stop, [this] { notify(); });
+
+    while (!stop.stop_requested())
+    {
+        // Idle: nothing to present until the simulation publishes a dirty frame
+        if (!animating)
+            _wakeUps.wait(woken, std::memory_order_acquire);
+        woken = _wakeUps.load(std::memory_order_acquire);
+        if (stop.stop_requested())
+            break;
+
+        // Between two frames: what's drawn next sees the whole upload
+        runUploads();
+
+        // A static frame still gets drawn if a dirty one was published since the last look:
+        // it may have replaced it in the buffer before being acquired
+        auto const   published = _published.load(std::memory_order_acquire);
+        auto const   dirty     = _dirtyFrames.load(std::memory_order_acquire);
+        auto const & frame     = _frames.acquire();
+        _acquired.store(published, std::memory_order_release); // Done with the older ones
+        if (std::exchange(seen, published) != published)
+            animating = std::exchange(seenDirty, dirty) != dirty && !frame.screens.empty();
+        if (!animating)
+            continue; // Static, or nothing simulated yet
+
+        _window.setDrawnSize(frame.windowSize);
+
+        // The snapshot only moves once per tick: extrapolate how far into the next one we are
+        auto const sinceTick = std::chrono::duration<float>(Clock::now() - frame.simulated);
+        auto const alpha     = std::min(frame.alpha + sinceTick.count() / frame.tick.asSeconds(),
+                                        1.f);
+
+        sf::Clock drawClock;
+        {
+            PROFILE_ZONE("Draw");
+
+            // Only the bottom screen can have a post effect: overlays aren't affected by it
+            auto const & base = *frame.screens.front();
+            if (auto const * const effect = base.postEffect())
+                drawThrough(*effect, base, frame, alpha, offscreen);
+            else
+            {
+                offscreen.reset();
+
+                // The letterboxed view scales the game straight into the window's viewport
+                _window.setView(frame.view);
+                _window.clear();
+                base.draw(_window, alpha);
+            }
+
+            _window.setView(frame.view);
+            for (auto it = std::next(frame.screens.begin()); it != frame.screens.end(); ++it)
+                (*it)->draw(_window, alpha);
+        }
+        drawTime += drawClock.getElapsedTime();
+
+        {
+            PROFILE_ZONE("Display");
+            _window.display();
+        }
+        Core::Profiler::markFrame();
+
+        if (++frames; _logStats && clock.getElapsedTime() >= sf::seconds(1.f))
+        {
+            auto const total = skippedFrames();
+            spdlog::info("{:.0f} fps | draw {:.3f} ms/frame | {} static frame(s) skipped",
+                         static_cast<float>(frames) / clock.restart().asSeconds(),
+                         drawTime.asSeconds() * 1000.f / static_cast<float>(frames),
+                         total - std::exchange(skipped, total));
+            drawTime = sf::Time::Zero;
+            frames   = 0;
+        }
+    }
+
+    static_cast<void>(_window.setActive(false));
+}
+catch (...)
+{
+    _error = std::current_exception();
+    _failed.store(true, std::memory_order_release);
+}
+
+void Renderer::runUploads()
+{
+    std::vector<std::function<void()>> uploads;
+    {
+        std::scoped_lock const lock(_uploadMutex);
+        uploads.swap(_uploads);
+    }
+
+    if (uploads.empty())
+        return;
+
+    PROFILE_ZONE("Upload");
+    for (auto && step : uploads)
+        step();
+}
+
+void Renderer::drawThrough(sf::Shader const & effect, Screen const & screen, Frame const & frame,
+                           float alpha, std::optional<sf::RenderTexture> & offscreen)
+{
+    // Pixel for pixel with the viewport, so that the blit doesn't resample
+    auto const viewport = _window.getViewport(frame.view);
+    auto const size     = sf::Vector2u(sf::Vector2i(viewport.width, viewport.height));
+    if (!offscreen || offscreen->getSize() != size)
+    {
+        offscreen.emplace();
+        Core::bAssert(offscreen->create(size.x, size.y),
+                      "Failed to create {}x{} offscreen target", size.x, size.y);
+    }
+
+    auto view = frame.view;
+    view.setViewport(sf::FloatRect(0.f, 0.f, 1.f, 1.f));
+    offscreen->setView(view);
+    offscreen->clear();
+    screen.draw(*offscreen, alpha);
+    offscreen->display();
+
+    auto const windowSize = sf::Vector2f(_window.getSize());
+    _window.setView(sf::View(sf::FloatRect(0.f, 0.f, windowSize.x, windowSize.y)));
+    _window.clear();
+
+    sf::Sprite blit(offscreen->getTexture());
+    blit.setPosition(sf::Vector2f(sf::Vector2i(viewport.left, viewport.top)));
+    _window.draw(blit, sf::RenderStates(&effect));
+    Core::Profiler::countDrawCalls();
+}
@@ -0,0 +1,131 @@
+/// @file   Renderer.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// Project includes
+#include "../core/TripleBuffer.hpp"
+
+// third-party includes
+#include <SFML/Graphics/View.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+// C++ includes
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace sf
+{
+    class RenderTexture;
+    class Shader;
+} // !namespace sf
+
+namespace Engine
+{
+    class Renderer;
+    class Screen;
+    class Window;
+} // !namespace Engine
+
+/// Draws and presents on its own thread, with its own GL context, so that a present blocking
+/// on vsync never holds back event polling nor simulation. Idles while published frames are
+/// static: nothing is drawn nor presented until one is dirty again. GPU uploads and window
+/// resizes run there too, between two frames: the main thread only polls the window's events.
+class Engine::Renderer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Filled by the simulation thread, read by the render thread
+    struct Frame
+    {
+        /// Drawn bottom first. Must outlive every frame numbered before acquired() reaches past
+        /// the last one referencing them.
+        std::vector<Screen const *> screens;
+        sf::View                    view;
+        sf::Vector2u                windowSize; ///< As of the last Resized event
+        Clock::time_point           simulated; ///< When its last tick ran
+        float                       alpha = 0.f;
+        sf::Time                    tick;
+        bool                        dirty = true; ///< Differs from the last one
+    };
+
+private:
+    Window &                           _window;
+    bool                               _logStats;
+    Core::TripleBuffer<Frame>          _frames;
+    std::atomic<std::uint64_t>         _wakeUps       { 0 }; ///< Waited on by the render thread
+    std::atomic<std::uint64_t>         _published     { 0 };
+    std::atomic<std::uint64_t>         _acquired      { 0 }; ///< Published when one was last read
+    std::atomic<std::uint64_t>         _dirtyFrames   { 0 }; ///< Published ones
+    std::atomic<std::uint64_t>         _skippedFrames { 0 };
+    std::mutex                         _uploadMutex;
+    std::vector<std::function<void()>> _uploads;
+    std::exception_ptr                 _error;
+    std::atomic<bool>                  _failed = false; ///< Publishes _error
+    std::jthread                       _thread; // Last: stopped and joined before the rest
+
+public:
+    /// Takes over @p window's GL context until destruction
+    /// @param logStats Logs the frame rate and draw cost once per second
+    explicit Renderer(Window & window, bool logStats = false);
+
+    Renderer(Renderer const &)             = delete;
+    Renderer & operator=(Renderer const &) = delete;
+
+public:
+    /// Frame to fill before publish(); overwrite every field
+    [[nodiscard]] auto frame() noexcept -> Frame & { return _frames.back(); }
+    void publish() noexcept;
+
+    /// Runs @p step on the render thread before it draws again: for GPU uploads, which would
+    /// change what a frame being drawn samples if done elsewhere
+    void upload(std::function<void()> step);
+
+    /// Resizes the window from the render thread, between two frames
+    void resize(sf::Vector2u size);
+
+    /// Frames are numbered from 1 as they're published: this is the last one's
+    [[nodiscard]] auto published() const noexcept -> std::uint64_t
+    {
+        return _published.load(std::memory_order_relaxed);
+    }
+
+    /// Frames numbered below this are never read again by the render thread: what only they
+    /// reference can be destroyed
+    [[nodiscard]] auto acquired() const noexcept -> std::uint64_t
+    {
+        return _acquired.load(std::memory_order_acquire);
+    }
+
+    /// Published frames that weren't dirty, hence never drawn
+    [[nodiscard]] auto skippedFrames() const noexcept -> std::uint64_t
+    {
+        return _skippedFrames.load(std::memory_order_relaxed);
+    }
+
+    /// Rethrows what stopped the render thread, if anything did
+    void check() const;
+
+private:
+    /// Wakes the render thread up
+    void notify() noexcept;
+
+    void run(std::stop_token const & stop);
+    void runUploads();
+
+    /// Draws @p screen into @p offscreen, (re)allocated at the viewport's size, then blits it
+    /// with @p effect
+    void drawThrough(sf::Shader const & effect, Screen const & screen, Frame const & frame,
+                     float alpha, std::optional<sf::RenderTexture> & offscreen);
+};
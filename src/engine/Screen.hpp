@@ -7,14 +7,20 @@
 // third-party includes
 #include <SFML/Graphics/Drawable.hpp>
 
+// C++ includes
+#include <filesystem>
+
 namespace sf
 {
     class Event;
+    class Shader;
     class Time;
 } // !namespace sf
 
 namespace Engine
 {
+    class AssetLoader;
+
     class Screen : public sf::Drawable
     {
     public:
@@ -28,13 +34,51 @@ namespace Engine
         Screen & operator=(Screen const &) noexcept = delete;
 
     public:
+        // Simulation thread
+
         virtual void onEvent(sf::Event const  &) {}
+        /// Called at a fixed rate, with the tick duration
         virtual void update (sf::Time  const  &) {}
+        /// Called after the frame's updates: snapshots what draw() renders
+        virtual void publish() {}
+
+        /// Whether the next publish() changes what draw() renders, animations included. Frames
+        /// where no screen is dirty and no event came in are neither drawn nor presented.
+        [[nodiscard]] virtual auto dirty() const -> bool { return true; }
+
+    public:
+        // Render thread: only reads the last published snapshot
 
-        /****/  void draw(sf::RenderTarget & target) const { draw(target, sf::RenderStates()); }
+        /****/  void draw(sf::RenderTarget & target, float alpha = 1.f) const
+        {
+            draw(target, sf::RenderStates(), alpha);
+        }
         virtual void draw(sf::RenderTarget &, sf::RenderStates) const {}
 
+        /// @p alpha is how far the frame is between the last update and the next one, in [0, 1):
+        /// override to interpolate moving things, it's ignored otherwise.
+        virtual void draw(sf::RenderTarget & target, sf::RenderStates states, float) const
+        {
+            draw(target, states);
+        }
+
+        /// Full-screen shader applied to what draw() rendered. Screens without one are drawn
+        /// straight to the window, saving an offscreen pass.
+        [[nodiscard]] virtual auto postEffect() const -> sf::Shader const * { return nullptr; }
+
     public:
+        // Simulation thread
+
+        /// Queues the screen's assets. enter() is only called once they're all loaded.
+        virtual void load(AssetLoader &) {}
+
+        /// Called when @p path was written while the screen is on the stack: reloads what came
+        /// from it, through the loader
+        virtual void reload(std::filesystem::path const &, AssetLoader &) {}
+
+        /// Overlays are drawn over the screen below, which keeps running instead of pausing
+        [[nodiscard]] virtual auto overlay() const -> bool { return false; }
+
         virtual void enter()  {}
         virtual void pause()  {}
         virtual void resume() {}
@@ -7,6 +7,10 @@
 // Project includes
 #include "Screen.hpp"
 
+// C++ includes
+#include <algorithm>
+#include <iterator>
+
 using namespace Engine;
 
 namespace
@@ -14,9 +18,10 @@ namespace
     class EmptyScreen : public Screen {};
 } // !namespace
 
-ScreenManager::ScreenManager()
+ScreenManager::ScreenManager(AssetArchive const & archive, std::pmr::memory_resource * arena)
+    : _arena(arena), _loader(archive)
 {
-    _screens.push(std::make_shared<EmptyScreen>());
+    _screens.push_back(make<EmptyScreen>());
 }
 
 auto ScreenManager::size() const -> std::size_t
@@ -24,24 +29,63 @@ auto ScreenManager::size() const -> std::size_t
     return _screens.size() - 1;
 }
 
-auto ScreenManager::push(BaseScreenPtr ptr) -> Screen &
+auto ScreenManager::active() const -> std::span<ScreenPtr const>
 {
-    if (!empty())
-        _screens.top()->pause();
+    // The empty screen at the bottom is never an overlay
+    auto const base = std::find_if(_screens.rbegin(), _screens.rend(),
+                                   [](auto const & screen) { return !screen->overlay(); });
+    return { std::prev(base.base()), _screens.end() };
+}
+
+auto ScreenManager::push(ScreenPtr ptr) -> Screen &
+{
+    auto & screen = *ptr;
+    screen.load(_loader);
 
-    _screens.push(std::move(ptr));
-    _screens.top()->enter();
-    return *_screens.top();
+    _loading.push_back(std::move(ptr));
+    update(); // Activates it right away if it has nothing to load
+    return screen;
 }
 
-void ScreenManager::pop()
+void ScreenManager::pop(std::uint64_t fence)
 {
     if (!empty())
     {
-        _screens.top()->exit();
-        _screens.pop();
+        auto const overlay = _screens.back()->overlay();
+        _screens.back()->exit();
+        if (fence != 0)
+            _retired.push_back({ std::move(_screens.back()), fence });
+        _screens.pop_back();
+
+        if (!empty() && !overlay)
+            _screens.back()->resume();
+    }
+}
+
+void ScreenManager::release(std::uint64_t reached)
+{
+    std::erase_if(_retired, [reached](Retired const & retired) {
+        return retired.fence <= reached;
+    });
+}
+
+void ScreenManager::update()
+{
+    _loader.pump();
+
+    while (!_loading.empty() && _loader.idle())
+    {
+        if (!empty() && !_loading.front()->overlay())
+            _screens.back()->pause();
 
-        if (!empty())
-            _screens.top()->resume();
+        _screens.push_back(std::move(_loading.front()));
+        _loading.pop_front();
+        _screens.back()->enter();
     }
 }
+
+void ScreenManager::reload(std::filesystem::path const & path)
+{
+    for (auto && screen : _screens)
+        screen->reload(path, _loader);
+}
@@ -5,44 +5,129 @@
 #pragma once
 
 // Project includes
+#include "AssetLoader.hpp"
 #include "Screen.hpp"
 
 // C++ includes
+#include <algorithm>
+#include <cstdint>
 #include <memory>
-#include <stack>
+#include <memory_resource>
+#include <deque>
+#include <span>
+#include <vector>
 
 namespace Engine
 {
     class ScreenManager
     {
-        template<class T>
-        using ScreenPtr     = std::shared_ptr<T>;
-        using BaseScreenPtr = ScreenPtr<Screen>;
+    public:
+        /// Gives the screen's memory back to the arena it was allocated from
+        struct Deleter
+        {
+            std::pmr::memory_resource * arena = nullptr;
+            void (*destroy)(std::pmr::memory_resource *, Screen *) = nullptr; ///< As its type
+
+            void operator()(Screen * screen) const { destroy(arena, screen); }
+        };
+
+        /// Uniquely owned: the manager's stack is the only owner
+        using ScreenPtr = std::unique_ptr<Screen, Deleter>;
 
     private:
-        std::stack<BaseScreenPtr> _screens;
+        struct Retired
+        {
+            ScreenPtr     screen;
+            std::uint64_t fence; ///< Destroyed once release() reaches it
+        };
+
+    private:
+        std::pmr::memory_resource * _arena;
+        std::vector<ScreenPtr>      _screens; ///< Stack, top last
+        std::deque<ScreenPtr>       _loading; ///< Pushed, waiting for their assets, in order
+        std::vector<Retired>        _retired; ///< Popped, maybe still drawn
+        AssetLoader                 _loader;
+
+    public:
+        /// Screens are allocated from @p arena, which must outlive the manager
+        explicit ScreenManager(AssetArchive const &        archive,
+                               std::pmr::memory_resource * arena = std::pmr::new_delete_resource());
 
     public:
-        ScreenManager();
+        ScreenManager(ScreenManager const &)             = delete;
+        ScreenManager & operator=(ScreenManager const &) = delete;
 
     public:
+        /// Returns right away: the screen becomes the top one once its assets are loaded
         template<class T, typename... Args>
         auto push(Args &&... args) -> T &;
-        void pop();
+
+        /// Exits the top screen, destroyed once release() reaches @p fence: frames handed to
+        /// another thread before may still draw it. With no fence, it's destroyed right away.
+        void pop(std::uint64_t fence = 0);
+
+        /// Destroys the popped screens whose fence is at most @p reached
+        void release(std::uint64_t reached);
+
+        /// Finishes loaded assets and activates the screens whose assets are all loaded
+        void update();
+
+        /// Hands @p path, written on disk, to every screen of the stack
+        void reload(std::filesystem::path const & path);
 
     public:
-        [[nodiscard]] auto top()   const -> BaseScreenPtr { return _screens.top(); }
-        [[nodiscard]] auto size()  const -> std::size_t;
-        [[nodiscard]] auto empty() const -> bool          { return size() == 0;    }
+        [[nodiscard]] auto top()     const -> Screen &      { return *_screens.back(); }
+        /// The top screen and the ones below it up to the first non-overlay, bottom first:
+        /// the ones to update and draw this frame
+        [[nodiscard]] auto active()  const -> std::span<ScreenPtr const>;
+        [[nodiscard]] auto size()    const -> std::size_t;
+        [[nodiscard]] auto empty()   const -> bool          { return size() == 0;    }
+        [[nodiscard]] auto loading() const -> bool          { return !_loading.empty(); }
+        [[nodiscard]] auto loader()  const -> AssetLoader const & { return _loader; }
+        [[nodiscard]] auto loader()        -> AssetLoader &       { return _loader; }
+
+        /// Whether the top screen is a T, e.g. to toggle an overlay
+        template<class T>
+        [[nodiscard]] auto isTop() const -> bool;
+        /// Whether a T was pushed and is still waiting for its assets
+        template<class T>
+        [[nodiscard]] auto queued() const -> bool;
 
     private:
-        auto push(BaseScreenPtr ptr) -> Screen &;
+        template<class T, typename... Args>
+        auto make(Args &&... args) -> ScreenPtr;
+
+        auto push(ScreenPtr ptr) -> Screen &;
     };
 
     template<class T, typename... Args>
     inline auto ScreenManager::push(Args && ... args) -> T &
     {
         static_assert(std::is_base_of_v<Screen, T>, "T must inherit Engine::Screen");
-        return static_cast<T &>(push(std::make_shared<T>(std::forward<Args>(args)...)));
+        return static_cast<T &>(push(make<T>(std::forward<Args>(args)...)));
+    }
+
+    template<class T>
+    inline auto ScreenManager::isTop() const -> bool
+    {
+        return !empty() && dynamic_cast<T const *>(_screens.back().get()) != nullptr;
+    }
+
+    template<class T>
+    inline auto ScreenManager::queued() const -> bool
+    {
+        return std::ranges::any_of(_loading, [](ScreenPtr const & screen) {
+            return dynamic_cast<T const *>(screen.get()) != nullptr;
+        });
+    }
+
+    template<class T, typename... Args>
+    inline auto ScreenManager::make(Args && ... args) -> ScreenPtr
+    {
+        std::pmr::polymorphic_allocator<T> allocator(_arena);
+        return ScreenPtr(allocator.template new_object<T>(std::forward<Args>(args)...), {
+            _arena, [](std::pmr::memory_resource * arena, Screen * screen) {
+                std::pmr::polymorphic_allocator<T>(arena).delete_object(static_cast<T *>(screen));
+            } });
     }
 } // !namespace Engine
@@ -0,0 +1,53 @@
+/// @file   SpriteBatch.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "SpriteBatch.hpp"
+
+// Project includes
+#include "../core/Profiler.hpp"
+
+// third-party includes
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+
+using namespace Engine;
+
+void SpriteBatch::add(sf::Sprite const & sprite)
+{
+    // Only consecutive sprites are merged: drawn in the order they were added, whatever their
+    // pages, overlapping sprites stack as they would drawn one by one
+    auto const * texture = sprite.getTexture();
+    if (_batches.empty() || _batches.back().first != texture)
+        _batches.emplace_back(texture, sf::VertexArray(sf::Quads));
+
+    auto const   bounds    = sprite.getLocalBounds();
+    auto const & transform = sprite.getTransform();
+    auto const   rect      = sf::FloatRect(sprite.getTextureRect());
+    auto const   color     = sprite.getColor();
+
+    auto & vertices = _batches.back().second;
+    vertices.append({ transform.transformPoint(0.f, 0.f), color,
+                      { rect.left, rect.top } });
+    vertices.append({ transform.transformPoint(bounds.width, 0.f), color,
+                      { rect.left + rect.width, rect.top } });
+    vertices.append({ transform.transformPoint(bounds.width, bounds.height), color,
+                      { rect.left + rect.width, rect.top + rect.height } });
+    vertices.append({ transform.transformPoint(0.f, bounds.height), color,
+                      { rect.left, rect.top + rect.height } });
+}
+
+void SpriteBatch::clear()
+{
+    _batches.clear();
+}
+
+void SpriteBatch::draw(sf::RenderTarget & target, sf::RenderStates states) const
+{
+    for (auto && [texture, vertices] : _batches)
+    {
+        states.texture = texture;
+        target.draw(vertices, states);
+    }
+    Core::Profiler::countDrawCalls(_batches.size());
+}
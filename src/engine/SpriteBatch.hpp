@@ -0,0 +1,40 @@
+/// @file   SpriteBatch.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// third-party includes
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+// C++ includes
+#include <utility>
+#include <vector>
+
+namespace sf
+{
+    class Sprite;
+    class Texture;
+} // !namespace sf
+
+namespace Engine { class SpriteBatch; }
+
+/// Merges consecutive sprites sharing a texture into one vertex array, i.e. one draw call per
+/// run of sprites from the same atlas page. Sprites are drawn in the order they were added:
+/// adding them page by page keeps the draw calls down.
+class Engine::SpriteBatch final : public sf::Drawable
+{
+private:
+    std::vector<std::pair<sf::Texture const *, sf::VertexArray>> _batches;
+
+public:
+    void add(sf::Sprite const & sprite);
+    void clear();
+
+public:
+    [[nodiscard]] auto drawCalls() const -> std::size_t { return _batches.size(); }
+
+private:
+    void draw(sf::RenderTarget & target, sf::RenderStates states) const override;
+};
@@ -0,0 +1,249 @@
+/// @file   TextBatch.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "TextBatch.hpp"
+
+// Project includes
+#include "FontManager.hpp"
+#include "../core/Exception.hpp"
+#include "../core/Profiler.hpp"
+#include "../core/Result.hpp"
+
+// third-party includes
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <utility>
+
+using namespace Engine;
+
+namespace
+{
+    constexpr float italicShear  = 0.209f; // 12 degrees, as sf::Text
+    constexpr float glyphPadding = 1.f;    // Around glyphs in the font's texture, as sf::Text
+
+    /// Two triangles for @p glyph at @p position, as sf::Text lays them out
+    void addGlyph(std::vector<sf::Vertex> & vertices, sf::Vector2f position, sf::Color color,
+                  sf::Glyph const & glyph, float shear, float outline)
+    {
+        auto const left   = glyph.bounds.left - glyphPadding;
+        auto const top    = glyph.bounds.top  - glyphPadding;
+        auto const right  = glyph.bounds.left + glyph.bounds.width  + glyphPadding;
+        auto const bottom = glyph.bounds.top  + glyph.bounds.height + glyphPadding;
+
+        auto const rect = sf::FloatRect(glyph.textureRect);
+        auto const u1   = rect.left - glyphPadding;
+        auto const v1   = rect.top  - glyphPadding;
+        auto const u2   = rect.left + rect.width  + glyphPadding;
+        auto const v2   = rect.top  + rect.height + glyphPadding;
+
+        auto const x = position.x - outline;
+        auto const y = position.y - outline;
+        sf::Vertex const topLeft    ({ x + left  - shear * top,    y + top    }, color, { u1, v1 });
+        sf::Vertex const topRight   ({ x + right - shear * top,    y + top    }, color, { u2, v1 });
+        sf::Vertex const bottomLeft ({ x + left  - shear * bottom, y + bottom }, color, { u1, v2 });
+        sf::Vertex const bottomRight({ x + right - shear * bottom, y + bottom }, color, { u2, v2 });
+
+        vertices.insert(vertices.end(),
+                        { topLeft, topRight, bottomLeft, bottomLeft, topRight, bottomRight });
+    }
+} // !namespace
+
+auto TextBatch::add(sf::Text const & text, FontManager const & fonts) -> Handle
+{
+    auto const * const font = text.getFont();
+    Core::bAssert(font != nullptr, "Batched text '{}' has no font",
+                  text.getString().toAnsiString());
+    checkPrewarmed(text, fonts);
+
+    auto const size = text.getCharacterSize();
+    auto it = std::find_if(_pages.begin(), _pages.end(), [&](Page const & page) {
+        return page.font == font && page.characterSize == size;
+    });
+    if (it == _pages.end())
+        it = _pages.insert(it, { &font->getTexture(size), font, size, {}, 0 });
+
+    it->version = ++_versions;
+    auto & vertices = it->vertices;
+    auto const first = vertices.size();
+    build(text, vertices);
+
+    auto & entry = _entries.emplace_back(Entry{ static_cast<std::size_t>(it - _pages.begin()),
+                                                first, vertices.size() - first, {} });
+    assign(entry.key, text);
+    return _entries.size() - 1;
+}
+
+auto TextBatch::update(Handle handle, sf::Text const & text, FontManager const & fonts) -> bool
+{
+    auto & entry = _entries[handle];
+    if (matches(entry.key, text))
+        return false;
+
+    auto & page = _pages[entry.page];
+    if (text.getFont() != page.font || text.getCharacterSize() != page.characterSize) [[unlikely]]
+    {
+        MAKE_ERROR("Batched text '{}' changed font or size",
+                   text.getString().toAnsiString()).raise();
+    }
+    checkPrewarmed(text, fonts);
+
+    _scratch.clear();
+    build(text, _scratch);
+    page.version = ++_versions;
+
+    auto const at = page.vertices.begin() + static_cast<std::ptrdiff_t>(entry.first);
+    if (_scratch.size() == entry.count)
+        std::copy(_scratch.begin(), _scratch.end(), at);
+    else
+    {
+        // Glyphs came or went: the texts after this one in its page move along
+        auto const removed = static_cast<std::ptrdiff_t>(entry.count);
+        page.vertices.insert(page.vertices.erase(at, at + removed),
+                             _scratch.begin(), _scratch.end());
+        for (auto & other : _entries)
+        {
+            if (other.page == entry.page && other.first > entry.first)
+                other.first = other.first - entry.count + _scratch.size();
+        }
+        entry.count = _scratch.size();
+    }
+
+    assign(entry.key, text);
+    return true;
+}
+
+void TextBatch::clear()
+{
+    _pages  .clear();
+    _entries.clear();
+}
+
+void TextBatch::copyPagesFrom(TextBatch const & other)
+{
+    // Versions only grow: a page left from before a clear() of other can't match a new one
+    _pages.resize(other._pages.size());
+    for (std::size_t i = 0; i < _pages.size(); ++i)
+    {
+        auto & page = _pages[i];
+        if (page.version == other._pages[i].version)
+            continue;
+
+        // Vertices reuse their storage: nothing is allocated once it's big enough
+        page.texture       = other._pages[i].texture;
+        page.font          = other._pages[i].font;
+        page.characterSize = other._pages[i].characterSize;
+        page.vertices.assign(other._pages[i].vertices.begin(), other._pages[i].vertices.end());
+        page.version       = other._pages[i].version;
+    }
+    _entries.clear();
+}
+
+auto TextBatch::matches(Key const & key, sf::Text const & text) -> bool
+{
+    auto const * const matrix = text.getTransform().getMatrix();
+    return key.string           == text.getString()
+        && key.fill             == text.getFillColor()
+        && key.outline          == text.getOutlineColor()
+        && key.outlineThickness == text.getOutlineThickness()
+        && key.style            == text.getStyle()
+        && key.letterSpacing    == text.getLetterSpacing()
+        && key.lineSpacing      == text.getLineSpacing()
+        && std::equal(key.transform.begin(), key.transform.end(), matrix);
+}
+
+void TextBatch::assign(Key & key, sf::Text const & text)
+{
+    // Only copied when it changed: sf::String's storage keeps its capacity
+    if (key.string != text.getString())
+        key.string = text.getString();
+
+    key.fill             = text.getFillColor();
+    key.outline          = text.getOutlineColor();
+    key.outlineThickness = text.getOutlineThickness();
+    key.style            = text.getStyle();
+    key.letterSpacing    = text.getLetterSpacing();
+    key.lineSpacing      = text.getLineSpacing();
+
+    auto const * const matrix = text.getTransform().getMatrix();
+    std::copy(matrix, matrix + key.transform.size(), key.transform.begin());
+}
+
+void TextBatch::checkPrewarmed(sf::Text const & text, FontManager const & fonts)
+{
+    // Rasterizing a glyph can swap the font's page texture for a bigger one, while the render
+    // thread draws with it
+    if (!fonts.prewarmed(text)) [[unlikely]]
+    {
+        MAKE_ERROR("Batched text '{}' isn't pre-warmed: size {}, outline {}, style {}",
+                   text.getString().toAnsiString(), text.getCharacterSize(),
+                   text.getOutlineThickness(), text.getStyle()).raise();
+    }
+}
+
+void TextBatch::build(sf::Text const & text, std::vector<sf::Vertex> & vertices)
+{
+    auto const & font      = *text.getFont();
+    auto const   size      = text.getCharacterSize();
+    auto const   bold      = (text.getStyle() & sf::Text::Bold) != 0;
+    auto const   shear     = (text.getStyle() & sf::Text::Italic) ? italicShear : 0.f;
+    auto const & transform = text.getTransform();
+
+    // Spacing as computed by sf::Text
+    auto       whitespace    = font.getGlyph(U' ', size, bold).advance;
+    auto const letterSpacing = (whitespace / 3.f) * (text.getLetterSpacing() - 1.f);
+    whitespace += letterSpacing;
+    auto const lineSpacing = font.getLineSpacing(size) * text.getLineSpacing();
+
+    auto const first = vertices.size();
+
+    // Outlines first, so that each text's fill is drawn over them
+    auto const layout = [&](sf::Color color, float outline) {
+        auto          x        = 0.f;
+        auto          y        = static_cast<float>(size);
+        std::uint32_t previous = 0;
+        for (auto const c : text.getString())
+        {
+            if (c == U'\r')
+                continue;
+
+            x += font.getKerning(previous, c, size);
+            previous = c;
+
+            /**/ if (c == U' ')  { x += whitespace;            continue; }
+            else if (c == U'\t') { x += whitespace * 4.f;      continue; }
+            else if (c == U'\n') { y += lineSpacing; x = 0.f;  continue; }
+
+            // Sizes and outlines were checked by checkPrewarmed(): the code point is left
+            Core::bAssert(c >= FontManager::firstPrewarmed && c <= FontManager::lastPrewarmed,
+                          "Glyph U+{:04X} isn't pre-warmed", static_cast<std::uint32_t>(c));
+
+            auto const & glyph = font.getGlyph(c, size, bold, outline);
+            addGlyph(vertices, { x, y }, color, glyph, shear, outline);
+
+            // Outline glyphs advance as the fill ones do
+            x += font.getGlyph(c, size, bold).advance + letterSpacing;
+        }
+    };
+    if (auto const outline = text.getOutlineThickness(); outline != 0.f)
+        layout(text.getOutlineColor(), outline);
+    layout(text.getFillColor(), 0.f);
+
+    for (auto it = vertices.begin() + static_cast<std::ptrdiff_t>(first); it != vertices.end();
+         ++it)
+        it->position = transform.transformPoint(it->position);
+}
+
+void TextBatch::draw(sf::RenderTarget & target, sf::RenderStates states) const
+{
+    for (auto && page : _pages)
+    {
+        states.texture = page.texture;
+        target.draw(page.vertices.data(), page.vertices.size(), sf::Triangles, states);
+    }
+    Core::Profiler::countDrawCalls(_pages.size());
+}
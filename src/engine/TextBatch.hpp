@@ -0,0 +1,115 @@
+/// @file   TextBatch.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// third-party includes
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/String.hpp>
+
+// C++ includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine
+{
+    class FontManager;
+    class TextBatch;
+} // !namespace Engine
+
+namespace sf
+{
+    class Font;
+    class Text;
+    class Texture;
+} // !namespace sf
+
+/// Merges texts into one vertex array per glyph page (font and character size), i.e. one draw
+/// call for all the texts sharing a font and size, outlines included. Each text keeps its own
+/// range of vertices, rewritten only when the text changed. Texts sharing a page keep their
+/// relative order, each outline drawn under its own fill as sf::Text does.
+/// Underlined and struck-through styles aren't supported, nor glyphs FontManager doesn't
+/// pre-warm: requesting a new one could resize the font's page while it's being drawn. Texts
+/// are checked against @p fonts when added or updated, their code points as they're built.
+class Engine::TextBatch final : public sf::Drawable
+{
+public:
+    using Handle = std::size_t;
+
+private:
+    struct Page
+    {
+        sf::Texture const *     texture;
+        sf::Font const *        font;
+        unsigned                characterSize;
+        std::vector<sf::Vertex> vertices; ///< Triangles
+        std::uint64_t           version;  ///< Unique to these vertices, for copyPagesFrom()
+    };
+
+    /// What the glyphs of a text were last built from
+    struct Key
+    {
+        sf::String            string;
+        std::array<float, 16> transform{};
+        sf::Color             fill, outline;
+        float                 outlineThickness = 0.f;
+        std::uint32_t         style            = 0;
+        float                 letterSpacing    = 1.f;
+        float                 lineSpacing      = 1.f;
+    };
+
+    struct Entry
+    {
+        std::size_t page;
+        std::size_t first; ///< Of its vertices in the page
+        std::size_t count;
+        Key         key;
+    };
+
+private:
+    std::vector<Page>       _pages;
+    std::vector<Entry>      _entries;
+    std::vector<sf::Vertex> _scratch; // Reused by update()
+    std::uint64_t           _versions = 0; ///< Given out to pages, never reset
+
+public:
+    /// Appends the glyphs of @p text: drawn over the texts of its page added before
+    auto add(sf::Text const & text, FontManager const & fonts) -> Handle;
+
+    /// Rebuilds the glyphs of the text added as @p handle if @p text changed since. Only its
+    /// range is rewritten, unless its glyph count changed: the rest of its page then moves.
+    /// @return Whether anything was rebuilt
+    /// @warning @p text must keep the font and character size it was added with
+    auto update(Handle handle, sf::Text const & text, FontManager const & fonts) -> bool;
+
+    void clear();
+
+    /// Draws what @p other draws from now on, copying only the pages that changed since this
+    /// batch last did. For a copy handed to the render thread: its texts can't be updated.
+    void copyPagesFrom(TextBatch const & other);
+
+public:
+    [[nodiscard]] auto size()      const -> std::size_t { return _entries.size(); }
+    [[nodiscard]] auto drawCalls() const -> std::size_t { return _pages.size();   }
+
+private:
+    /// Whether @p text would build the glyphs @p key was made from. Compared in place: copying
+    /// its string would allocate.
+    [[nodiscard]] static auto matches(Key const & key, sf::Text const & text) -> bool;
+
+    /// Makes @p key describe @p text, reusing the storage of its string
+    static void assign(Key & key, sf::Text const & text);
+
+    /// Throws unless @p fonts pre-warmed the font, size and outline of @p text
+    static void checkPrewarmed(sf::Text const & text, FontManager const & fonts);
+
+    /// Builds the glyphs of @p text into @p vertices, in world coordinates
+    static void build(sf::Text const & text, std::vector<sf::Vertex> & vertices);
+
+    void draw(sf::RenderTarget & target, sf::RenderStates states) const override;
+};
@@ -0,0 +1,151 @@
+/// @file   TextureAtlas.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "TextureAtlas.hpp"
+
+// Project includes
+#include "../core/Exception.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+
+using namespace Engine;
+
+namespace
+{
+    constexpr auto padding = 1; // Keeps neighbours from bleeding into each other
+} // !namespace
+
+auto Engine::packAtlas(std::vector<NamedImage> const & images, unsigned pageSize) -> TextureAtlas
+{
+    // Tallest first keeps shelves tight
+    std::vector<std::size_t> order(images.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](auto lhs, auto rhs) {
+        return images[lhs].second.getSize().y > images[rhs].second.getSize().y;
+    });
+
+    TextureAtlas atlas;
+    std::vector<sf::IntRect> rects(images.size());
+    std::vector<std::size_t> pages(images.size());
+
+    auto const size = static_cast<int>(pageSize);
+    int pageCount = 0, x = size, y = 0, shelfHeight = 0;
+
+    for (auto const i : order)
+    {
+        auto const & [name, image] = images[i];
+        auto const width  = static_cast<int>(image.getSize().x);
+        auto const height = static_cast<int>(image.getSize().y);
+        Core::bAssert(width <= size && height <= size,
+                      "Image '{}' ({}x{}) doesn't fit in a {}px atlas page",
+                      name, width, height, size);
+
+        if (x + width > size) // New shelf
+        {
+            x = 0;
+            y += shelfHeight;
+            shelfHeight = 0;
+        }
+        if (pageCount == 0 || y + height > size) // New page
+        {
+            ++pageCount;
+            x = y = shelfHeight = 0;
+        }
+
+        rects[i] = sf::IntRect(x, y, width, height);
+        pages[i] = static_cast<std::size_t>(pageCount - 1);
+
+        x += width + padding;
+        shelfHeight = std::max(shelfHeight, height + padding);
+    }
+
+    atlas.pages.resize(static_cast<std::size_t>(pageCount));
+    for (auto & page : atlas.pages)
+        page.create(pageSize, pageSize, sf::Color::Transparent);
+
+    for (std::size_t i = 0; i < images.size(); ++i)
+    {
+        auto const & [name, image] = images[i];
+        atlas.pages[pages[i]].copy(image, static_cast<unsigned>(rects[i].left),
+                                          static_cast<unsigned>(rects[i].top));
+        atlas.regions.insert_or_assign(name, AtlasRegion{ pages[i], rects[i] });
+    }
+
+    return atlas;
+}
+
+void Engine::saveAtlas(TextureAtlas const & atlas, std::filesystem::path const & index)
+{
+    std::filesystem::create_directories(index.parent_path());
+
+    std::ofstream file(index);
+    Core::bAssert(file.is_open(), "Failed to open atlas index {}", index.string());
+
+    file << "pages " << atlas.pages.size() << '\n';
+    for (auto && [name, region] : atlas.regions)
+    {
+        file << fmt::format("{} {} {} {} {} {}\n", region.page, region.rect.left, region.rect.top,
+                            region.rect.width, region.rect.height, name);
+    }
+
+    for (std::size_t i = 0; i < atlas.pages.size(); ++i)
+    {
+        auto const path = atlasPagePath(index, i);
+        Core::bAssert(atlas.pages[i].saveToFile(path.string()),
+                      "Failed to save atlas page {}", path.string());
+    }
+}
+
+auto Engine::loadAtlas(std::filesystem::path const & index) -> TextureAtlas
+{
+    auto [pageCount, regions] = loadAtlasIndex(index);
+
+    TextureAtlas atlas;
+    atlas.regions = std::move(regions);
+    atlas.pages.resize(pageCount);
+    for (std::size_t i = 0; i < pageCount; ++i)
+    {
+        auto const path = atlasPagePath(index, i);
+        Core::bAssert(atlas.pages[i].loadFromFile(path.string()),
+                      "Failed to load atlas page {}", path.string());
+    }
+
+    return atlas;
+}
+
+auto Engine::loadAtlasIndex(std::filesystem::path const & index) -> AtlasIndex
+{
+    std::ifstream file(index);
+    Core::bAssert(file.is_open(), "Failed to open atlas index {}", index.string());
+    return loadAtlasIndex(file, index.string());
+}
+
+auto Engine::loadAtlasIndex(std::istream & stream, std::string_view name) -> AtlasIndex
+{
+    AtlasIndex  atlas;
+    std::string header;
+    Core::bAssert(stream >> header >> atlas.pageCount && header == "pages",
+                  "Invalid atlas index {}", name);
+
+    AtlasRegion region;
+    std::string key;
+    while (stream >> region.page >> region.rect.left  >> region.rect.top
+                  >> region.rect.width >> region.rect.height >> std::ws
+           && std::getline(stream, key))
+    {
+        Core::bAssert(region.page < atlas.pageCount, "Invalid page for '{}' in {}", key, name);
+        atlas.regions.insert_or_assign(key, region);
+    }
+
+    return atlas;
+}
+
+auto Engine::atlasPagePath(std::filesystem::path const & index, std::size_t page)
+    -> std::filesystem::path
+{
+    return index.parent_path() / fmt::format("{}_{}.png", index.stem().string(), page);
+}
@@ -0,0 +1,55 @@
+/// @file   TextureAtlas.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// third-party includes
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+// C++ includes
+#include <filesystem>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Engine
+{
+    struct AtlasRegion
+    {
+        std::size_t page = 0;
+        sf::IntRect rect;
+    };
+
+    /// Images packed into one or a few pages, keyed by the name they were packed with
+    struct TextureAtlas
+    {
+        std::vector<sf::Image>                       pages;
+        std::unordered_map<std::string, AtlasRegion> regions;
+    };
+
+    /// Atlas as described by its index file, pages not loaded
+    struct AtlasIndex
+    {
+        std::size_t                                  pageCount = 0;
+        std::unordered_map<std::string, AtlasRegion> regions;
+    };
+
+    using NamedImage = std::pair<std::string, sf::Image>;
+
+    /// Shelf-packs @p images into as few @p pageSize x @p pageSize pages as possible
+    auto packAtlas(std::vector<NamedImage> const & images, unsigned pageSize) -> TextureAtlas;
+
+    /// Writes the index to @p index and the pages next to it as <stem>_<n>.png
+    void saveAtlas(TextureAtlas const & atlas, std::filesystem::path const & index);
+    auto loadAtlas(std::filesystem::path const & index) -> TextureAtlas;
+
+    auto loadAtlasIndex(std::filesystem::path const & index) -> AtlasIndex;
+    auto loadAtlasIndex(std::istream & stream, std::string_view name) -> AtlasIndex;
+    auto atlasPagePath (std::filesystem::path const & index, std::size_t page)
+        -> std::filesystem::path;
+} // !namespace Engine
@@ -5,22 +5,307 @@
 #include "TextureManager.hpp"
 
 // Project includes
+#include "AssetArchive.hpp"
+#include "AssetLoader.hpp"
 #include "../core/Exception.hpp"
 
+// third-party includes
+#include <spdlog/spdlog.h>
+
+// C++ includes
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
 using namespace Engine;
 
-auto TextureManager::load(std::string name, std::filesystem::path const & path) -> sf::Texture &
+namespace
+{
+    constexpr auto maxPageSize = 1024u;
+    constexpr auto noPage      = std::numeric_limits<std::size_t>::max(); ///< Staged, not packed
+
+    /// Through @p loader's uploader, or right away without a loader
+    void upload(AssetLoader * loader, AssetLoader::Finish step)
+    {
+        if (loader)
+            loader->upload(std::move(step));
+        else
+            step();
+    }
+} // !namespace
+
+void TextureManager::loadAtlas(std::filesystem::path const & index)
+{
+    auto atlas = Engine::loadAtlas(index);
+    auto const firstPage = addPages(std::move(atlas.pages), nullptr);
+
+    for (auto && [path, region] : atlas.regions)
+        _prebuilt.insert_or_assign(path, AtlasRegion{ firstPage + region.page, region.rect });
+}
+
+void TextureManager::loadAtlas(std::filesystem::path const & index, AssetLoader & loader)
+{
+    auto const & archive = loader.archive();
+    auto const * const archived = archive.find(index.generic_string());
+
+    auto const [pageCount, regions] = [&] {
+        if (!archived)
+            return loadAtlasIndex(index);
+
+        auto const * const text = reinterpret_cast<char const *>(archived->data.data());
+        std::istringstream stream(std::string(text, archived->data.size()));
+        return loadAtlasIndex(stream, index.generic_string());
+    }();
+
+    auto const firstPage = _pages->size();
+    _pages->resize(firstPage + pageCount); // Filled in by uploads as the loader completes
+
+    for (auto && [path, region] : regions)
+        _prebuilt.insert_or_assign(path, AtlasRegion{ firstPage + region.page, region.rect });
+
+    for (std::size_t i = 0; i < pageCount; ++i)
+    {
+        auto path = atlasPagePath(index, i);
+
+        // Textures are created here, so that the render thread never sees the deque change
+        auto * const page = &(*_pages)[firstPage + i];
+
+        // Archived pages are already decoded: upload them straight from the mapping
+        if (auto const * entry = archive.find(path.generic_string()))
+        {
+            Core::bAssert(entry->type == Archive::Type::Image,
+                          "Atlas page {} isn't an image", path.generic_string());
+            loader.upload([pages = _pages, page, entry, path] {
+                Core::bAssert(page->create(entry->width, entry->height),
+                              "Failed to create atlas page {}", path.generic_string());
+                page->update(reinterpret_cast<sf::Uint8 const *>(entry->data.data()));
+            });
+            continue;
+        }
+
+        loader.enqueue(path.generic_string(), [pages = _pages, page, path, &loader] {
+            sf::Image image;
+            Core::bAssert(image.loadFromFile(path.string()),
+                          "Failed to load atlas page {}", path.string());
+
+            return [pages, page, path, &loader, image = std::move(image)]() mutable {
+                loader.upload([pages, page, path, image = std::move(image)] {
+                    Core::bAssert(page->loadFromImage(image),
+                                  "Failed to upload atlas page {}", path.generic_string());
+                });
+            };
+        });
+    }
+}
+
+auto TextureManager::load(std::string name, std::filesystem::path const & path) -> TextureId
 {
-    auto & texture = _textures.try_emplace(std::move(name)).first->second;
-    Core::bAssert(texture.loadFromFile(path.string()),
+    auto const id = intern(name);
+    _paths.insert_or_assign(path.generic_string(), id);
+    if (alias(id, path))
+        return id;
+
+    sf::Image image;
+    Core::bAssert(image.loadFromFile(path.string()),
                   "Failed to load texture '{}' from {}", name, path.string());
-    return texture;
+    _staged.emplace_back(std::move(name), std::move(image));
+    return id;
+}
+
+auto TextureManager::load(std::string name, std::filesystem::path const & path,
+                          AssetLoader & loader) -> TextureId
+{
+    auto const id = intern(name);
+    _paths.insert_or_assign(path.generic_string(), id);
+    if (alias(id, path))
+        return id;
+
+    if (auto const * entry = loader.archive().find(path.generic_string()))
+    {
+        Core::bAssert(entry->type == Archive::Type::Image,
+                      "Archived texture '{}' isn't an image", name);
+
+        sf::Image image;
+        image.create(entry->width, entry->height,
+                     reinterpret_cast<sf::Uint8 const *>(entry->data.data()));
+        _staged.emplace_back(std::move(name), std::move(image));
+        return id;
+    }
+
+    loader.enqueue(path.generic_string(), [this, alive = weak(), name = std::move(name), path] {
+        sf::Image image;
+        Core::bAssert(image.loadFromFile(path.string()),
+                      "Failed to load texture '{}' from {}", name, path.string());
+
+        // Staging is cheap, the upload happens when packing
+        return [this, alive, name, image = std::move(image)]() mutable {
+            if (!alive.expired())
+                _staged.emplace_back(std::move(name), std::move(image));
+        };
+    });
+    return id;
+}
+
+void TextureManager::pack()
+{
+    pack(nullptr);
+}
+
+void TextureManager::pack(AssetLoader & loader)
+{
+    pack(&loader);
+}
+
+void TextureManager::pack(AssetLoader * loader)
+{
+    if (_staged.empty())
+        return;
+
+    auto const pageSize  = std::min(maxPageSize, sf::Texture::getMaximumSize());
+    auto       atlas     = packAtlas(_staged, pageSize);
+    auto const firstPage = addPages(std::move(atlas.pages), loader);
+
+    for (auto && [name, region] : atlas.regions)
+    {
+        _regions[static_cast<std::size_t>(*id(name))] = // Staged names are interned
+            AtlasRegion{ firstPage + region.page, region.rect };
+    }
+
+    _staged.clear();
+}
+
+auto TextureManager::reload(std::filesystem::path const & path, AssetLoader & loader) -> bool
+{
+    auto const it = _paths.find(path.generic_string());
+    if (it == _paths.end())
+        return false;
+
+    loader.enqueue(path.generic_string(),
+                   [this, alive = weak(), path, &loader, id = it->second]() -> AssetLoader::Finish {
+        sf::Image image;
+        if (!image.loadFromFile(path.string()))
+        {
+            // Likely read mid-write: the end of the write triggers another reload
+            spdlog::warn("[TextureManager] Failed to reload {}", path.generic_string());
+            return [] {};
+        }
+
+        return [this, alive, id, &loader, image = std::move(image)]() mutable {
+            if (!alive.expired()) // The screen owning us may be gone by now
+                replace(id, std::move(image), loader);
+        };
+    });
+    return true;
+}
+
+auto TextureManager::sprite(TextureId id) const -> Core::Result<sf::Sprite>
+{
+    auto const index = static_cast<std::size_t>(id);
+    if (index >= _regions.size() || _regions[index].page == noPage) [[unlikely]]
+        return MAKE_ERROR("No texture loaded for id {}", index);
+
+    auto const & region = _regions[index];
+    return sf::Sprite((*_pages)[region.page], region.rect);
+}
+
+auto TextureManager::sprite(std::string_view name) const -> Core::Result<sf::Sprite>
+{
+    auto const textureId = id(name);
+    if (!textureId) [[unlikely]]
+        return textureId.error();
+    return sprite(*textureId);
+}
+
+auto TextureManager::id(std::string_view name) const -> Core::Result<TextureId>
+{
+    auto const it = _ids.find(name);
+    if (it == _ids.end()) [[unlikely]]
+        return MAKE_ERROR("No texture loaded for '{}'", name);
+    return it->second;
+}
+
+auto TextureManager::intern(std::string name) -> TextureId
+{
+    if (auto const it = _ids.find(name); it != _ids.end())
+        return it->second;
+
+    Core::bAssert(_regions.size() <= std::numeric_limits<std::underlying_type_t<TextureId>>::max(),
+                  "Too many textures, can't intern '{}'", name);
+
+    auto const id = static_cast<TextureId>(_regions.size());
+    _regions.push_back(AtlasRegion{ noPage, {} });
+    _ids.emplace(std::move(name), id);
+    return id;
+}
+
+auto TextureManager::alias(TextureId id, std::filesystem::path const & path) -> bool
+{
+    auto const it = _prebuilt.find(path.generic_string());
+    if (it == _prebuilt.end())
+        return false;
+
+    _regions[static_cast<std::size_t>(id)] = it->second;
+    return true;
+}
+
+auto TextureManager::addPages(std::vector<sf::Image> pages, AssetLoader * loader) -> std::size_t
+{
+    auto const firstPage = _pages->size();
+    for (auto && image : pages)
+    {
+        upload(loader, [pages = _pages, page = &_pages->emplace_back(), image = std::move(image)] {
+            Core::bAssert(page->loadFromImage(image), "Failed to upload an atlas page");
+        });
+    }
+    return firstPage;
+}
+
+void TextureManager::replace(TextureId id, sf::Image image, AssetLoader & loader)
+{
+    auto &     region = _regions[static_cast<std::size_t>(id)];
+    auto const size   = sf::Vector2i(image.getSize());
+    if (region.page == noPage)
+    {
+        // Not packed yet: packed along with the others
+        auto const named = std::find_if(_ids.begin(), _ids.end(),
+                                        [id](auto const & pair) { return pair.second == id; });
+        _staged.emplace_back(named->first, std::move(image));
+        ++_version;
+        return;
+    }
+
+    auto * const page = &(*_pages)[region.page];
+    if (std::find(_ownPages.begin(), _ownPages.end(), region.page) != _ownPages.end())
+    {
+        // Alone in its page: the page is made again at its size
+        upload(&loader, [pages = _pages, page, image = std::move(image)] {
+            Core::bAssert(page->loadFromImage(image), "Failed to upload a reloaded texture");
+        });
+        region.rect = { 0, 0, size.x, size.y };
+    }
+    else if (size.x <= region.rect.width && size.y <= region.rect.height)
+    {
+        // Fits its region: uploaded over it, shrinking it if it's smaller
+        upload(&loader, [pages = _pages, page, left = region.rect.left, top = region.rect.top,
+                         image = std::move(image)] {
+            page->update(image, static_cast<unsigned>(left), static_cast<unsigned>(top));
+        });
+        region.rect.width  = size.x;
+        region.rect.height = size.y;
+    }
+    else
+    {
+        // Outgrew its region: gets a page of its own, reused by its next reloads. The old
+        // region stays unused, once per texture.
+        std::vector<sf::Image> pages;
+        pages.push_back(std::move(image));
+        region = AtlasRegion{ addPages(std::move(pages), &loader), { 0, 0, size.x, size.y } };
+        _ownPages.push_back(region.page);
+    }
+    ++_version;
 }
 
-auto TextureManager::sprite(std::string const & name) const -> sf::Sprite
+auto TextureManager::weak() const -> std::weak_ptr<char>
 {
-    sf::Sprite sprite;
-    Core::bAssert(_textures.contains(name), "No texture loaded for '{}'", name);
-    sprite.setTexture(_textures.at(name));
-    return sprite;
+    return _alive;
 }
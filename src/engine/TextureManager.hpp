@@ -4,24 +4,99 @@
 
 #pragma once
 
+// Project includes
+#include "TextureAtlas.hpp"
+#include "../core/Result.hpp"
+#include "../core/StringHash.hpp"
+
 // third-party includes
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 // C++ includes
+#include <cstdint>
+#include <deque>
 #include <filesystem>
+#include <memory>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
+
+namespace Engine
+{
+    class AssetLoader;
+
+    /// Handle interned by TextureManager::load(): a dense index, so lookups don't hash
+    enum class TextureId : std::uint16_t {};
 
-namespace Engine { class TextureManager; }
+    class TextureManager;
+} // !namespace Engine
 
+/// Serves every texture as a sub-rect of a few atlas pages, so sprites can be batched per page.
+/// Work still queued on an AssetLoader when the manager is destroyed is dropped; uploads still
+/// queued keep the pages alive until they ran.
 class Engine::TextureManager
 {
 private:
-    std::unordered_map<std::string, sf::Texture> _textures;
+    using Pages = std::deque<sf::Texture>; // deque keeps sprite textures valid
+
+private:
+    // Shared with the uploads still queued, watched by finish steps: both may outlive us
+    std::shared_ptr<Pages>                       _pages = std::make_shared<Pages>();
+    std::shared_ptr<char>                        _alive = std::make_shared<char>();
+
+    std::vector<std::size_t>                     _ownPages; ///< Each holds one reloaded texture
+    std::vector<AtlasRegion>                     _regions;  ///< Indexed by TextureId
+    Core::StringMap<TextureId>                   _ids;
+    std::unordered_map<std::string, AtlasRegion> _prebuilt; ///< Regions of loadAtlas(), by path
+    std::vector<NamedImage>                      _staged;
+    Core::StringMap<TextureId>                   _paths;    ///< Loaded from, for reload()
+    std::size_t                                  _version = 0;
 
 public:
-    auto load(std::string name, std::filesystem::path const & path) -> sf::Texture &;
+    /// Makes the images packed by the DarkOrbitAtlas tool available to load() without disk I/O
+    void loadAtlas(std::filesystem::path const & index);
+    void loadAtlas(std::filesystem::path const & index, AssetLoader & loader);
+
+    /// Registers @p path as @p name. Unless it is part of a loaded atlas, the image is staged
+    /// and only becomes available once pack() is called.
+    auto load(std::string name, std::filesystem::path const & path) -> TextureId;
+    /// Same as above, but the image is read and decoded by @p loader: call pack() once it's idle
+    auto load(std::string name, std::filesystem::path const & path, AssetLoader & loader)
+        -> TextureId;
+
+    /// Packs the staged images into new atlas pages and uploads them, right away or through
+    /// @p loader's uploader
+    void pack();
+    void pack(AssetLoader & loader);
+
+    /// Decodes @p path again on a worker of @p loader if a texture was loaded from it, then
+    /// uploads it over its region through the loader's uploader: its sprites stay valid if its
+    /// size didn't change. A smaller image shrinks the region, a bigger one gets a page of its
+    /// own, replaced whole by the next reloads: its sprites must then be made again.
+    /// Failures are logged, the texture keeps its pixels.
+    /// @return Whether a texture was loaded from @p path
+    auto reload(std::filesystem::path const & path, AssetLoader & loader) -> bool;
 
 public:
-    [[nodiscard]] auto sprite(std::string const & name) const -> sf::Sprite;
+    /// Fails if nothing was loaded as @p id, or it wasn't packed yet
+    [[nodiscard]] auto sprite(TextureId id) const -> Core::Result<sf::Sprite>;
+
+    /// Slower fallback for names that weren't interned by the caller
+    [[nodiscard]] auto sprite(std::string_view name) const -> Core::Result<sf::Sprite>;
+    [[nodiscard]] auto id    (std::string_view name) const -> Core::Result<TextureId>;
+
+    [[nodiscard]] auto pageCount() const -> std::size_t { return _pages->size(); }
+    /// Changes whenever reload() uploaded a texture
+    [[nodiscard]] auto version()   const -> std::size_t { return _version;      }
+
+private:
+    auto intern(std::string name) -> TextureId;
+    auto alias (TextureId id, std::filesystem::path const & path) -> bool;
+    void pack(AssetLoader * loader);
+    auto addPages(std::vector<sf::Image> pages, AssetLoader * loader) -> std::size_t;
+    void replace(TextureId id, sf::Image image, AssetLoader & loader);
+
+    /// For finish steps: expires with the manager
+    [[nodiscard]] auto weak() const -> std::weak_ptr<char>;
 };
@@ -0,0 +1,38 @@
+/// @file   Window.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// third-party includes
+#include <SFML/Graphics/RenderWindow.hpp>
+
+namespace Engine { class Window; }
+
+/// Window drawn to by Engine::Renderer while the main thread polls its events. Handling a
+/// Resized event leaves the view and the size views are mapped with alone: the render thread
+/// owns both, and applies what each frame hands it.
+class Engine::Window final : public sf::RenderWindow
+{
+private:
+    sf::Vector2u _drawnSize; ///< Render thread, once it took the window over
+
+public:
+    using sf::RenderWindow::RenderWindow;
+
+public:
+    /// Render thread: views are mapped to @p size from now on
+    void setDrawnSize(sf::Vector2u size) noexcept { _drawnSize = size; }
+
+    /// The size drawing uses, rather than the one pollEvent() updates from the main thread
+    [[nodiscard]] auto getSize() const -> sf::Vector2u override { return _drawnSize; }
+
+protected:
+    void onCreate() override
+    {
+        _drawnSize = sf::Window::getSize(); // Before the default view is made from it
+        sf::RenderWindow::onCreate();
+    }
+
+    void onResize() override {}
+};
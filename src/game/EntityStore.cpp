@@ -0,0 +1,171 @@
+/// @file   EntityStore.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "EntityStore.hpp"
+
+// Project includes
+#include "../core/Exception.hpp"
+
+// C++ includes
+#include <utility>
+
+using namespace Game;
+
+namespace
+{
+    template<typename Table>
+    void removeRow(Table & table, std::size_t row)
+    {
+        table.columns([row](auto & column) {
+            column[row] = std::move(column.back());
+            column.pop_back();
+        });
+    }
+
+    template<typename Table>
+    void reserveRows(Table & table, std::size_t rows)
+    {
+        table.columns([rows](auto & column) { column.reserve(rows); });
+    }
+
+    template<typename Table>
+    auto tableBytes(Table const & table) -> std::size_t
+    {
+        std::size_t bytes = 0;
+        table.columns([&](auto const & column) {
+            bytes += column.capacity() * sizeof(column[0]);
+        });
+        return bytes;
+    }
+
+    void appendMotion(Motion & motion, float x, float y, float vx, float vy)
+    {
+        motion.x.push_back(x);
+        motion.y.push_back(y);
+        motion.vx.push_back(vx);
+        motion.vy.push_back(vy);
+    }
+} // !namespace
+
+auto EntityStore::spawn(ShipDesc const & desc) -> EntityId
+{
+    auto const id = allocate(Archetype::Ship, _ships.ids.size());
+
+    _ships.ids.push_back(id);
+    appendMotion(_ships.motion, desc.x, desc.y, desc.vx, desc.vy);
+    _ships.appearance.sprite.push_back(desc.sprite);
+    _ships.appearance.rotation.push_back(0.f);
+    _ships.hp.push_back(desc.hp);
+    _ships.maxHp.push_back(desc.maxHp);
+    _ships.shield.push_back(desc.shield);
+    _ships.maxShield.push_back(desc.maxShield);
+    _ships.shieldRegen.push_back(desc.shieldRegen);
+    _ships.faction.push_back(desc.faction);
+    return id;
+}
+
+auto EntityStore::spawn(ProjectileDesc const & desc) -> EntityId
+{
+    auto const id = allocate(Archetype::Projectile, _projectiles.ids.size());
+
+    _projectiles.ids.push_back(id);
+    appendMotion(_projectiles.motion, desc.x, desc.y, desc.vx, desc.vy);
+    _projectiles.appearance.sprite.push_back(desc.sprite);
+    _projectiles.appearance.rotation.push_back(0.f);
+    _projectiles.lifetime.push_back(desc.lifetime);
+    _projectiles.damage.push_back(desc.damage);
+    _projectiles.faction.push_back(desc.faction);
+    return id;
+}
+
+void EntityStore::destroy(EntityId id)
+{
+    if (!alive(id))
+        return;
+
+    auto & slot = _slots[id.index];
+    auto & ids  = slot.archetype == Archetype::Ship ? _ships.ids : _projectiles.ids;
+
+    // The last row takes the place of the destroyed one
+    _slots[ids.back().index].row = slot.row;
+    if (slot.archetype == Archetype::Ship)
+        removeRow(_ships, slot.row);
+    else
+        removeRow(_projectiles, slot.row);
+
+    slot.alive = false;
+    ++slot.generation;
+    _freeSlots.push_back(id.index);
+}
+
+void EntityStore::clear()
+{
+    _ships.columns([](auto & column) { column.clear(); });
+    _projectiles.columns([](auto & column) { column.clear(); });
+
+    // Bumping the generations invalidates every id handed out so far
+    _freeSlots.clear();
+    for (std::uint32_t i = 0; i < _slots.size(); ++i)
+    {
+        if (_slots[i].alive)
+            ++_slots[i].generation;
+        _slots[i].alive = false;
+        _freeSlots.push_back(i);
+    }
+}
+
+void EntityStore::reserve(std::size_t ships, std::size_t projectiles)
+{
+    reserveRows(_ships, ships);
+    reserveRows(_projectiles, projectiles);
+    _slots.reserve(ships + projectiles);
+    _freeSlots.reserve(ships + projectiles);
+}
+
+auto EntityStore::alive(EntityId id) const -> bool
+{
+    return id.index < _slots.size()
+        && _slots[id.index].alive
+        && _slots[id.index].generation == id.generation;
+}
+
+auto EntityStore::archetype(EntityId id) const -> Archetype
+{
+    Core::bAssert(alive(id), "Entity {}:{} is dead", id.index, id.generation);
+    return _slots[id.index].archetype;
+}
+
+auto EntityStore::row(EntityId id) const -> std::size_t
+{
+    Core::bAssert(alive(id), "Entity {}:{} is dead", id.index, id.generation);
+    return _slots[id.index].row;
+}
+
+auto EntityStore::memoryUsage() const -> std::size_t
+{
+    return tableBytes(_ships) + tableBytes(_projectiles)
+         + _slots.capacity() * sizeof(Slot) + _freeSlots.capacity() * sizeof(std::uint32_t);
+}
+
+auto EntityStore::allocate(Archetype archetype, std::size_t row) -> EntityId
+{
+    std::uint32_t index;
+    if (_freeSlots.empty())
+    {
+        index = static_cast<std::uint32_t>(_slots.size());
+        Core::bAssert(index != EntityId::none, "Too many entities");
+        _slots.emplace_back();
+    }
+    else
+    {
+        index = _freeSlots.back();
+        _freeSlots.pop_back();
+    }
+
+    auto & slot = _slots[index];
+    slot.row       = static_cast<std::uint32_t>(row);
+    slot.archetype = archetype;
+    slot.alive     = true;
+    return { index, slot.generation };
+}
@@ -0,0 +1,183 @@
+/// @file   EntityStore.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// C++ includes
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Game
+{
+    enum class Archetype : std::uint8_t { Ship, Projectile };
+
+    enum class Faction : std::uint8_t { Player, Ally, Enemy, Alien };
+
+    /// Stable handle: stays valid while the entity is alive, even when its row moves
+    struct EntityId
+    {
+        static constexpr auto none = std::numeric_limits<std::uint32_t>::max();
+
+        std::uint32_t index      = none;
+        std::uint32_t generation = 0;
+
+        [[nodiscard]] auto operator==(EntityId const &) const -> bool = default;
+    };
+
+    /// Columns every archetype has
+    struct Motion
+    {
+        std::vector<float> x, y;   ///< Map units
+        std::vector<float> vx, vy; ///< Map units per second
+    };
+
+    /// What the renderer needs, nothing more
+    struct Appearance
+    {
+        std::vector<std::uint16_t> sprite;   ///< Engine::TextureId of the owning screen
+        std::vector<float>         rotation; ///< Degrees
+    };
+
+    /// Ships and NPCs
+    struct ShipTable
+    {
+        std::vector<EntityId>      ids;
+        Motion                     motion;
+        Appearance                 appearance;
+        std::vector<std::uint32_t> hp, maxHp;
+        std::vector<std::uint32_t> shield, maxShield, shieldRegen; ///< Regen is per tick
+        std::vector<Faction>       faction;
+
+        /// Calls @p f on every column, in declaration order
+        template<typename F>
+        void columns(F && f);
+        template<typename F>
+        void columns(F && f) const;
+    };
+
+    /// Lasers and rockets
+    struct ProjectileTable
+    {
+        std::vector<EntityId>      ids;
+        Motion                     motion;
+        Appearance                 appearance;
+        std::vector<float>         lifetime; ///< Seconds left
+        std::vector<std::uint32_t> damage;
+        std::vector<Faction>       faction;
+
+        /// Calls @p f on every column, in declaration order
+        template<typename F>
+        void columns(F && f);
+        template<typename F>
+        void columns(F && f) const;
+    };
+
+    struct ShipDesc
+    {
+        float         x = 0.f, y = 0.f, vx = 0.f, vy = 0.f;
+        std::uint16_t sprite = 0;
+        std::uint32_t hp = 0, maxHp = 0, shield = 0, maxShield = 0, shieldRegen = 0;
+        Faction       faction = Faction::Alien;
+    };
+
+    struct ProjectileDesc
+    {
+        float         x = 0.f, y = 0.f, vx = 0.f, vy = 0.f;
+        std::uint16_t sprite   = 0;
+        float         lifetime = 1.f;
+        std::uint32_t damage   = 0;
+        Faction       faction  = Faction::Alien;
+    };
+
+    class EntityStore;
+} // !namespace Game
+
+/// Entities stored by archetype, one contiguous array per component (structure of arrays), so
+/// that systems stream through exactly the fields they touch. Destroying an entity moves the last
+/// row of its table into its place: rows are dense but not stable, ids are.
+class Game::EntityStore final
+{
+private:
+    struct Slot
+    {
+        std::uint32_t generation = 0;
+        std::uint32_t row        = 0;
+        Archetype     archetype  = Archetype::Ship;
+        bool          alive      = false;
+    };
+
+private:
+    ShipTable                  _ships;
+    ProjectileTable            _projectiles;
+    std::vector<Slot>          _slots;    ///< Indexed by EntityId::index
+    std::vector<std::uint32_t> _freeSlots;
+
+public:
+    auto spawn(ShipDesc       const & desc) -> EntityId;
+    auto spawn(ProjectileDesc const & desc) -> EntityId;
+
+    /// Does nothing if @p id is already dead
+    void destroy(EntityId id);
+    void clear();
+
+    /// Keeps the tables from reallocating until they hold that many rows
+    void reserve(std::size_t ships, std::size_t projectiles);
+
+public:
+    [[nodiscard]] auto alive(EntityId id) const -> bool;
+    /// @p id must be alive
+    [[nodiscard]] auto archetype(EntityId id) const -> Archetype;
+    /// Row of @p id in its archetype's table; only valid until the next destroy()
+    [[nodiscard]] auto row(EntityId id) const -> std::size_t;
+
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+        return _ships.ids.size() + _projectiles.ids.size();
+    }
+
+    [[nodiscard]] auto ships()             -> ShipTable             & { return _ships;       }
+    [[nodiscard]] auto ships()       const -> ShipTable       const & { return _ships;       }
+    [[nodiscard]] auto projectiles()       -> ProjectileTable       & { return _projectiles; }
+    [[nodiscard]] auto projectiles() const -> ProjectileTable const & { return _projectiles; }
+
+    /// Heap bytes held by the tables and slots, reserved capacity included
+    [[nodiscard]] auto memoryUsage() const -> std::size_t;
+
+private:
+    auto allocate(Archetype archetype, std::size_t row) -> EntityId;
+};
+
+template<typename F>
+inline void Game::ShipTable::columns(F && f)
+{
+    f(ids);
+    f(motion.x); f(motion.y); f(motion.vx); f(motion.vy);
+    f(appearance.sprite); f(appearance.rotation);
+    f(hp); f(maxHp); f(shield); f(maxShield); f(shieldRegen);
+    f(faction);
+}
+
+template<typename F>
+inline void Game::ProjectileTable::columns(F && f)
+{
+    f(ids);
+    f(motion.x); f(motion.y); f(motion.vx); f(motion.vy);
+    f(appearance.sprite); f(appearance.rotation);
+    f(lifetime); f(damage);
+    f(faction);
+}
+
+template<typename F>
+inline void Game::ShipTable::columns(F && f) const
+{
+    const_cast<ShipTable &>(*this).columns([&](auto & column) { f(std::as_const(column)); });
+}
+
+template<typename F>
+inline void Game::ProjectileTable::columns(F && f) const
+{
+    const_cast<ProjectileTable &>(*this).columns([&](auto & column) { f(std::as_const(column)); });
+}
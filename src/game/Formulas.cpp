@@ -1,13 +1,32 @@
 /// @file   Formulas.cpp
 /// @author Pierre Caissial
 /// @date   Created on 29/10/2021
+///
+/// Compile-time checks of the level table, on every boundary. DarkOrbitBench compares it with the
+/// former floating-point formula at runtime.
 
 #include "Formulas.hpp"
 
-// C++ includes
-#include <cmath>
+using namespace Formulas;
 
-uint8_t Formulas::getLevelFromXp(uint64_t xp)
+namespace
 {
-    return static_cast<uint8_t>(2 + std::log2l(static_cast<long double>(xp) / 10'000));
-}
+    constexpr auto boundariesHold() -> bool
+    {
+        for (uint8_t level = 2; level <= maxLevel; ++level)
+        {
+            auto const threshold = xpForLevel(level);
+            if (getLevelFromXp(threshold - 1) != level - 1 || getLevelFromXp(threshold) != level
+             || xpToNextLevel(threshold - 1) != 1
+             || levelProgress(threshold) != (level == maxLevel ? 1.f : 0.f))
+                return false;
+        }
+        return true;
+    }
+} // !namespace
+
+static_assert(getLevelFromXp(0) == 1 && getLevelFromXp(firstLevelUpXp - 1) == 1);
+static_assert(getLevelFromXp(UINT64_MAX) == maxLevel && xpToNextLevel(UINT64_MAX) == 0);
+static_assert(xpToNextLevel(0) == firstLevelUpXp && levelProgress(firstLevelUpXp / 2) == 0.5f);
+static_assert(maxLevel == 52);
+static_assert(boundariesHold());
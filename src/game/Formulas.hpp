@@ -5,9 +5,77 @@
 #pragma once
 
 // C++ includes
+#include <array>
+#include <cstddef>
 #include <cstdint>
 
 namespace Formulas
 {
-    uint8_t getLevelFromXp(uint64_t xp);
+    /// Level 2 takes 10'000 XP, and each level after that twice as much as the previous one
+    constexpr uint64_t firstLevelUpXp = 10'000;
+
+    /// Highest level a uint64_t of XP reaches
+    constexpr uint8_t maxLevel = [] {
+        uint8_t level = 2;
+        for (auto xp = firstLevelUpXp; xp <= UINT64_MAX / 2; xp *= 2)
+            ++level;
+        return level;
+    }();
+
+    /// XP at which each level starts: levelThresholds[level - 1]
+    constexpr auto levelThresholds = [] {
+        std::array<uint64_t, maxLevel> thresholds{};
+        for (std::size_t i = 1; i < thresholds.size(); ++i)
+            thresholds[i] = firstLevelUpXp << (i - 1);
+        return thresholds;
+    }();
+
+    /// Binary search over levelThresholds, without branches on @p xp
+    [[nodiscard]] constexpr auto getLevelFromXp(uint64_t xp) noexcept -> uint8_t;
+
+    /// XP at which @p level starts, clamped to [1, maxLevel]
+    [[nodiscard]] constexpr auto xpForLevel(uint8_t level) noexcept -> uint64_t;
+
+    /// XP still needed to reach the next level, 0 at maxLevel
+    [[nodiscard]] constexpr auto xpToNextLevel(uint64_t xp) noexcept -> uint64_t;
+
+    /// How far @p xp is into its level, in [0, 1): the fill of an XP bar. 1 at maxLevel.
+    [[nodiscard]] constexpr auto levelProgress(uint64_t xp) noexcept -> float;
 } // !namespace Formulas
+
+constexpr auto Formulas::getLevelFromXp(uint64_t xp) noexcept -> uint8_t
+{
+    // Last threshold <= xp. The loop count only depends on the table size, and the ternary
+    // compiles to a conditional move.
+    std::size_t first = 0;
+    for (auto count = levelThresholds.size(); count > 1; )
+    {
+        auto const half = count / 2;
+        first  = levelThresholds[first + half] <= xp ? first + half : first;
+        count -= half;
+    }
+    return static_cast<uint8_t>(first + 1);
+}
+
+constexpr auto Formulas::xpForLevel(uint8_t level) noexcept -> uint64_t
+{
+    level = level < 1 ? 1 : level > maxLevel ? maxLevel : level;
+    return levelThresholds[level - 1];
+}
+
+constexpr auto Formulas::xpToNextLevel(uint64_t xp) noexcept -> uint64_t
+{
+    auto const level = getLevelFromXp(xp);
+    return level == maxLevel ? 0 : levelThresholds[level] - xp;
+}
+
+constexpr auto Formulas::levelProgress(uint64_t xp) noexcept -> float
+{
+    auto const level = getLevelFromXp(xp);
+    if (level == maxLevel)
+        return 1.f;
+
+    auto const start = levelThresholds[level - 1];
+    auto const span  = levelThresholds[level] - start;
+    return static_cast<float>(static_cast<double>(xp - start) / static_cast<double>(span));
+}
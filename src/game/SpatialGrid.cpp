@@ -0,0 +1,88 @@
+/// @file   SpatialGrid.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "SpatialGrid.hpp"
+
+// Project includes
+#include "../core/Exception.hpp"
+
+using namespace Game;
+
+SpatialGrid::SpatialGrid(float width, float height, float cellSize)
+    : _cellSize(cellSize)
+    , _columns(std::max(static_cast<int>(std::ceil(width  / cellSize)), 1))
+    , _rows   (std::max(static_cast<int>(std::ceil(height / cellSize)), 1))
+{
+    Core::bAssert(cellSize > 0.f, "Invalid cell size {}", cellSize);
+    _cells.resize(static_cast<std::size_t>(_columns) * static_cast<std::size_t>(_rows));
+}
+
+void SpatialGrid::move(EntityId id, float x, float y)
+{
+    if (id.index >= _entries.size())
+        _entries.resize(id.index + 1);
+
+    auto &     entry = _entries[id.index];
+    auto const to    = cell(column(x), row(y));
+    if (entry.cell == to)
+    {
+        auto & item = _cells[to][entry.slot];
+        item.id = id; // Another generation may have taken the slot over
+        item.x  = x;
+        item.y  = y;
+        return;
+    }
+
+    if (entry.cell != Entry::none)
+        unlink(id.index);
+
+    auto & items = _cells[to];
+    entry.cell = to;
+    entry.slot = static_cast<std::uint32_t>(items.size());
+    items.push_back({ id, x, y });
+    ++_size;
+}
+
+void SpatialGrid::remove(EntityId id)
+{
+    if (contains(id))
+        unlink(id.index);
+}
+
+void SpatialGrid::clear()
+{
+    for (auto & items : _cells)
+        items.clear();
+    _entries.clear();
+    _size = 0;
+}
+
+auto SpatialGrid::contains(EntityId id) const -> bool
+{
+    return id.index < _entries.size()
+        && _entries[id.index].cell != Entry::none
+        && _cells[_entries[id.index].cell][_entries[id.index].slot].id == id;
+}
+
+auto SpatialGrid::memoryUsage() const -> std::size_t
+{
+    auto bytes = _cells.capacity() * sizeof(_cells[0]) + _entries.capacity() * sizeof(Entry);
+    for (auto const & items : _cells)
+        bytes += items.capacity() * sizeof(Item);
+    return bytes;
+}
+
+void SpatialGrid::unlink(std::uint32_t index)
+{
+    auto & entry = _entries[index];
+    auto & items = _cells[entry.cell];
+
+    // The last item of the cell takes the place of the removed one
+    items[entry.slot] = items.back();
+    _entries[items[entry.slot].id.index].slot = entry.slot;
+    items.pop_back();
+
+    entry.cell = Entry::none;
+    --_size;
+}
@@ -0,0 +1,215 @@
+/// @file   SpatialGrid.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// Project includes
+#include "EntityStore.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Game
+{
+    /// Axis-aligned area, in map units
+    struct Bounds
+    {
+        float left, top, width, height;
+    };
+
+    class SpatialGrid;
+} // !namespace Game
+
+/// Uniform grid over the map, bucketing entities by position for culling, radius, nearest-target
+/// and picking queries. Queries only visit the cells they overlap; moving an entity only touches
+/// the grid when it crosses into another cell. Entities are points: culling callers widen the
+/// bounds by their largest sprite.
+class Game::SpatialGrid final
+{
+private:
+    struct Item
+    {
+        EntityId id;
+        float    x, y;
+    };
+
+    /// Where an entity is, indexed by EntityId::index
+    struct Entry
+    {
+        static constexpr auto none = std::numeric_limits<std::uint32_t>::max();
+
+        std::uint32_t cell = none; ///< none when not in the grid
+        std::uint32_t slot = 0;    ///< Index in the cell
+    };
+
+private:
+    float                          _cellSize;
+    int                            _columns;
+    int                            _rows;
+    std::vector<std::vector<Item>> _cells;   ///< Row-major
+    std::vector<Entry>             _entries;
+    std::size_t                    _size = 0;
+
+public:
+    /// Positions out of the map are clamped to its border cells
+    SpatialGrid(float width, float height, float cellSize);
+
+public:
+    /// Inserts @p id, or updates its position if it's already in
+    void move(EntityId id, float x, float y);
+    /// Does nothing if @p id isn't in
+    void remove(EntityId id);
+    void clear();
+
+    /// Removes the entities for which @p alive(EntityId) is false
+    template<typename Alive>
+    void prune(Alive && alive);
+
+public:
+    [[nodiscard]] auto contains(EntityId id) const -> bool;
+    [[nodiscard]] auto size()                const -> std::size_t { return _size; }
+    /// Heap bytes held by the cells and entries, reserved capacity included
+    [[nodiscard]] auto memoryUsage()         const -> std::size_t;
+
+    /// Calls @p f(EntityId, x, y) for every entity inside @p bounds
+    template<typename F>
+    void forEachIn(Bounds const & bounds, F && f) const;
+
+    /// Calls @p f(EntityId, x, y) for every entity at @p radius or less from (@p x, @p y)
+    template<typename F>
+    void forEachInRadius(float x, float y, float radius, F && f) const;
+
+    /// Closest entity to (@p x, @p y) within @p maxRadius for which @p accept(EntityId) is true,
+    /// or an invalid id. Searches rings of cells outwards and stops as soon as no closer entity
+    /// can remain.
+    template<typename Accept>
+    [[nodiscard]] auto nearest(float x, float y, float maxRadius, Accept && accept) const
+        -> EntityId;
+
+private:
+    [[nodiscard]] auto column(float x) const -> int;
+    [[nodiscard]] auto row   (float y) const -> int;
+    [[nodiscard]] auto cell  (int column, int row) const -> std::uint32_t
+    {
+        return static_cast<std::uint32_t>(row * _columns + column);
+    }
+
+    /// Removes whatever entity is at @p index, whatever its generation
+    void unlink(std::uint32_t index);
+
+    /// Calls @p f(Item const &) for every item in the cells overlapping @p bounds
+    template<typename F>
+    void forEachCandidate(Bounds const & bounds, F && f) const;
+};
+
+inline auto Game::SpatialGrid::column(float x) const -> int
+{
+    auto const last = static_cast<float>(_columns - 1);
+    return static_cast<int>(std::clamp(std::floor(x / _cellSize), 0.f, last));
+}
+
+inline auto Game::SpatialGrid::row(float y) const -> int
+{
+    auto const last = static_cast<float>(_rows - 1);
+    return static_cast<int>(std::clamp(std::floor(y / _cellSize), 0.f, last));
+}
+
+template<typename Alive>
+inline void Game::SpatialGrid::prune(Alive && alive)
+{
+    for (std::uint32_t i = 0; i < _entries.size(); ++i)
+    {
+        auto const & entry = _entries[i];
+        if (entry.cell != Entry::none && !alive(_cells[entry.cell][entry.slot].id))
+            unlink(i);
+    }
+}
+
+template<typename F>
+inline void Game::SpatialGrid::forEachCandidate(Bounds const & bounds, F && f) const
+{
+    auto const right  = column(bounds.left + bounds.width);
+    auto const bottom = row   (bounds.top  + bounds.height);
+
+    for (auto r = row(bounds.top); r <= bottom; ++r)
+    {
+        for (auto c = column(bounds.left); c <= right; ++c)
+        {
+            for (auto const & item : _cells[cell(c, r)])
+                f(item);
+        }
+    }
+}
+
+template<typename F>
+inline void Game::SpatialGrid::forEachIn(Bounds const & bounds, F && f) const
+{
+    forEachCandidate(bounds, [&](Item const & item) {
+        if (item.x >= bounds.left && item.x <= bounds.left + bounds.width
+         && item.y >= bounds.top  && item.y <= bounds.top  + bounds.height)
+            f(item.id, item.x, item.y);
+    });
+}
+
+template<typename F>
+inline void Game::SpatialGrid::forEachInRadius(float x, float y, float radius, F && f) const
+{
+    auto const squared = radius * radius;
+    forEachCandidate({ x - radius, y - radius, 2.f * radius, 2.f * radius },
+                     [&](Item const & item) {
+        auto const dx = item.x - x;
+        auto const dy = item.y - y;
+        if (dx * dx + dy * dy <= squared)
+            f(item.id, item.x, item.y);
+    });
+}
+
+template<typename Accept>
+inline auto Game::SpatialGrid::nearest(float x, float y, float maxRadius, Accept && accept) const
+    -> EntityId
+{
+    EntityId best;
+    auto     bestSquared = maxRadius * maxRadius;
+
+    auto const c0    = column(x);
+    auto const r0    = row(y);
+    auto const rings = static_cast<int>(std::min(std::ceil(maxRadius / _cellSize),
+                                                 static_cast<float>(std::max(_columns, _rows))));
+    for (auto ring = 0; ring <= rings; ++ring)
+    {
+        // Every entity in this ring or beyond is at least that far
+        auto const minDistance = static_cast<float>(std::max(ring - 1, 0)) * _cellSize;
+        if (best.index != EntityId::none && minDistance * minDistance > bestSquared)
+            break;
+
+        for (auto r = std::max(r0 - ring, 0); r <= std::min(r0 + ring, _rows - 1); ++r)
+        {
+            // Only the outline of the ring: its inside was searched already
+            auto const edge = r == r0 - ring || r == r0 + ring;
+            auto const step = edge ? 1 : 2 * ring;
+            for (auto c = c0 - ring; c <= c0 + ring; c += std::max(step, 1))
+            {
+                if (c < 0 || c >= _columns)
+                    continue;
+
+                for (auto const & item : _cells[cell(c, r)])
+                {
+                    auto const dx      = item.x - x;
+                    auto const dy      = item.y - y;
+                    auto const squared = dx * dx + dy * dy;
+                    if (squared <= bestSquared && accept(item.id))
+                    {
+                        best        = item.id;
+                        bestSquared = squared;
+                    }
+                }
+            }
+        }
+    }
+    return best;
+}
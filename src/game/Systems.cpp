@@ -0,0 +1,91 @@
+/// @file   Systems.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "Systems.hpp"
+
+// Project includes
+#include "../core/Profiler.hpp"
+
+// C++ includes
+#include <algorithm>
+
+using namespace Game;
+
+namespace
+{
+    /// Separate x and y passes: each one reads two arrays and writes one, which vectorizes better
+    /// than a single pass interleaving four
+    void axpy(std::vector<float> & position, std::vector<float> const & velocity, float dt) noexcept
+    {
+        auto const n = position.size();
+        auto * const       p = position.data();
+        auto const * const v = velocity.data();
+        for (std::size_t i = 0; i < n; ++i)
+            p[i] += v[i] * dt;
+    }
+} // !namespace
+
+void Systems::integrate(Motion & motion, float dt) noexcept
+{
+    axpy(motion.x, motion.vx, dt);
+    axpy(motion.y, motion.vy, dt);
+}
+
+void Systems::regenerateShields(ShipTable & ships) noexcept
+{
+    auto const n = ships.shield.size();
+    auto * const       shield    = ships.shield.data();
+    auto const * const maxShield = ships.maxShield.data();
+    auto const * const regen     = ships.shieldRegen.data();
+
+    // No overflow: shields and regen both stay far below 2^31
+    for (std::size_t i = 0; i < n; ++i)
+        shield[i] = std::min(shield[i] + regen[i], maxShield[i]);
+}
+
+void Systems::expireProjectiles(EntityStore & entities, float dt)
+{
+    auto & lifetime = entities.projectiles().lifetime;
+    auto const n = lifetime.size();
+    auto * const life = lifetime.data();
+
+    std::uint32_t spent = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        life[i] -= dt;
+        spent += life[i] <= 0.f;
+    }
+    if (spent == 0)
+        return;
+
+    // Backwards, so that the rows moved by destroy() have already been checked
+    auto const & ids = entities.projectiles().ids;
+    for (auto i = lifetime.size(); i-- > 0;)
+    {
+        if (lifetime[i] <= 0.f)
+            entities.destroy(ids[i]);
+    }
+}
+
+void Systems::index(EntityStore const & entities, SpatialGrid & grid)
+{
+    PROFILE_ZONE("Spatial index");
+    grid.prune([&](EntityId id) { return entities.alive(id); });
+
+    auto const add = [&](auto const & table) {
+        for (std::size_t i = 0; i < table.ids.size(); ++i)
+            grid.move(table.ids[i], table.motion.x[i], table.motion.y[i]);
+    };
+    add(entities.ships());
+    add(entities.projectiles());
+}
+
+void Systems::update(EntityStore & entities, float dt)
+{
+    PROFILE_ZONE("Systems");
+    integrate(entities.ships().motion, dt);
+    integrate(entities.projectiles().motion, dt);
+    regenerateShields(entities.ships());
+    expireProjectiles(entities, dt);
+}
@@ -0,0 +1,30 @@
+/// @file   Systems.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// Project includes
+#include "EntityStore.hpp"
+#include "SpatialGrid.hpp"
+
+/// Per-tick game logic. Each system is a plain loop over a few columns, with no branch or call in
+/// the loop body, so that the compiler vectorizes it.
+namespace Game::Systems
+{
+    /// position += velocity * dt
+    void integrate(Motion & motion, float dt) noexcept;
+
+    /// Adds each ship's per-tick regen to its shield, up to its maximum
+    void regenerateShields(ShipTable & ships) noexcept;
+
+    /// Burns @p dt off each projectile's lifetime, then destroys the spent ones
+    void expireProjectiles(EntityStore & entities, float dt);
+
+    /// Brings @p grid up to date with the entities' positions, dead ones removed
+    void index(EntityStore const & entities, SpatialGrid & grid);
+
+    /// integrate(), regenerateShields() and expireProjectiles(), for one tick of @p dt seconds.
+    /// Queries need index() afterwards.
+    void update(EntityStore & entities, float dt);
+} // !namespace Game::Systems
@@ -0,0 +1,52 @@
+/// @file   World.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "World.hpp"
+
+// Project includes
+#include "Formulas.hpp"
+#include "Systems.hpp"
+#include "../core/Constants.hpp"
+
+using namespace Game;
+
+World::World(float cellSize)
+    : _grid(Constants::mapWidth, Constants::mapHeight, cellSize)
+{
+    _player.level = Formulas::getLevelFromXp(_player.xp);
+    _playerShip   = _entities.spawn(ShipDesc{
+        .x = 1'000.f, .y = 1'000.f,
+        .hp = _ship.curHp, .maxHp = _ship.maxHp, .shield = _ship.curShield,
+        .maxShield = _ship.maxShield, .faction = Faction::Player,
+    });
+}
+
+void World::apply(PlayerStats const & player, ShipStats const & ship)
+{
+    _player = player;
+    _ship   = ship;
+
+    auto &     ships = _entities.ships();
+    auto const row   = _entities.row(_playerShip);
+    ships.hp       [row] = _ship.curHp;
+    ships.maxHp    [row] = _ship.maxHp;
+    ships.shield   [row] = _ship.curShield;
+    ships.maxShield[row] = _ship.maxShield;
+}
+
+void World::update(float dt)
+{
+    Systems::update(_entities, dt);
+    Systems::index(_entities, _grid);
+
+    auto const & ships = _entities.ships();
+    auto const   row   = _entities.row(_playerShip);
+    _ship.curHp     = ships.hp[row];
+    _ship.curShield = ships.shield[row];
+}
+
+auto World::memoryUsage() const -> std::size_t
+{
+    return _entities.memoryUsage() + _grid.memoryUsage();
+}
@@ -0,0 +1,56 @@
+/// @file   World.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// Project includes
+#include "EntityStore.hpp"
+#include "PlayerStats.hpp"
+#include "ShipStats.hpp"
+#include "SpatialGrid.hpp"
+
+// C++ includes
+#include <cstddef>
+
+namespace Game { class World; }
+
+/// One player's view of the game, without any rendering: what the space map screen shows, and
+/// what a headless bot simulates
+class Game::World final
+{
+public:
+    /// The game's view spans about 4 by 3 cells
+    static constexpr auto defaultCellSize = 256.f;
+
+private:
+    PlayerStats _player;
+    ShipStats   _ship;       ///< The HUD's view of _playerShip, plus its cargo
+    EntityStore _entities;
+    SpatialGrid _grid;
+    EntityId    _playerShip;
+
+public:
+    /// Bots, which never query the grid, pass a coarse @p cellSize to keep it small
+    explicit World(float cellSize = defaultCellSize);
+
+    World(World const &)             = delete;
+    World & operator=(World const &) = delete;
+
+public:
+    /// Takes the server's stats over: it is authoritative for them
+    void apply(PlayerStats const & player, ShipStats const & ship);
+
+    /// One tick of @p dt seconds: systems, then the grid
+    void update(float dt);
+
+public:
+    [[nodiscard]] auto player()     const -> PlayerStats const & { return _player;     }
+    [[nodiscard]] auto ship()       const -> ShipStats   const & { return _ship;       }
+    [[nodiscard]] auto entities()   const -> EntityStore const & { return _entities;   }
+    [[nodiscard]] auto grid()       const -> SpatialGrid const & { return _grid;       }
+    [[nodiscard]] auto playerShip() const -> EntityId            { return _playerShip; }
+
+    /// Heap bytes held, on top of sizeof(World)
+    [[nodiscard]] auto memoryUsage() const -> std::size_t;
+};
@@ -5,72 +5,246 @@
 // Project includes
 #include "core/Constants.hpp"
 #include "core/Exception.hpp"
+#include "core/Logging.hpp"
+#include "core/Profiler.hpp"
+#include "engine/AssetArchive.hpp"
+#include "engine/AssetLoader.hpp"
+#include "engine/FileWatcher.hpp"
+#include "engine/FixedTimestep.hpp"
+#include "engine/FontManager.hpp"
+#include "engine/Renderer.hpp"
 #include "engine/ScreenManager.hpp"
+#include "engine/Window.hpp"
+#include "net/Client.hpp"
+#include "screens/ProfilerOverlay.hpp"
 #include "screens/SpaceMap.hpp"
+#include "utils/NumberFormat.hpp"
 
 // Third-party includes
-#include <SFML/Graphics/RenderTexture.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
-#include <SFML/Graphics/Sprite.hpp>
 #include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
 #include <SFML/Window/Event.hpp>
 #include <spdlog/spdlog.h>
 
+// C++ includes
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
 #ifdef _WIN32
 # include <windows.h>
 #endif
 
 namespace
 {
-    void configureLogging();
-    void initWindow(sf::Window & w);
-    void onWindowResize(sf::RenderWindow & w, sf::Vector2u windowSz);
+    /// Written by the DarkOrbitPack tool (`pak` build target). Loose files are used without it.
+    constexpr auto assetArchive = "assets.pak";
+    /// Loose files written there are reloaded live
+    constexpr auto assetDirectory = "assets";
+
+    /// Reserved on main()'s stack for the screens, which take a few KB each: overlays and menus
+    /// coming and going are recycled from it rather than heap-allocated. Past it, the heap.
+    constexpr std::size_t screenArenaSize = 64 * 1024;
+
+    struct Options
+    {
+        bool                  uncapped = false; ///< No vsync, logs frame and tick costs
+        std::filesystem::path trace;            ///< Chrome trace written on exit, if not empty
+        std::string           server;           ///< host[:port] to get the game state from
+        std::string           logLevel;         ///< Overrides SPDLOG_LEVEL, if not empty
+    };
+
+    /// Simulation cost, logged once per second. The renderer logs its own.
+    struct TickStats
+    {
+        sf::Time elapsed, cost;
+        unsigned ticks = 0;
+
+        void add(sf::Time frame, sf::Time tickCost, unsigned tickCount, sf::Time dropped);
+    };
+
+    auto parseOptions(std::span<char *> args) -> Options;
+    auto connect(Options const & options) -> std::unique_ptr<Net::Client>;
+    void configureLocale();
+    void mountAssets(Engine::AssetArchive & archive);
+    void initWindow(sf::Window & w, Engine::AssetArchive const & archive, Options const & options);
+    void loadFonts(Engine::FontManager & fontManager, Engine::AssetArchive const & archive);
+    auto onWindowResize(Engine::Renderer & renderer, sf::View const & defaultView,
+                        sf::Vector2u windowSize) -> sf::View;
     std::string getCurrentLocale();
 } // !namespace
 
-int main() try
+int main(int argc, char * argv[]) try
 {
 #ifdef _WIN32
     SetConsoleOutputCP(CP_UTF8);
 #endif
 
-    configureLogging();
+    Core::AsyncLogging const logging("DarkOrbit");
+    configureLocale();
+
+    auto const options = parseOptions(std::span(argv, static_cast<std::size_t>(argc)).subspan(1));
+    if (!options.logLevel.empty())
+        spdlog::set_level(Core::parseLogLevel(options.logLevel));
+
+    Engine::AssetArchive archive;
+    mountAssets(archive);
+
+    Engine::Window window;
+    initWindow(window, archive, options);
+
+    Engine::FontManager fontManager;
+    loadFonts(fontManager, archive);
+
+    auto const client = connect(options);
+
+    alignas(std::max_align_t) std::array<std::byte, screenArenaSize> screenStorage;
+    std::pmr::monotonic_buffer_resource    screenBuffer(screenStorage.data(), screenStorage.size());
+    std::pmr::unsynchronized_pool_resource screenArena(&screenBuffer);
+
+    Engine::ScreenManager screenManager(archive, &screenArena);
+    screenManager.push<Screens::SpaceMapScreen>(fontManager, client.get());
+
+    // Archived assets can't change under us
+    std::optional<Engine::FileWatcher> watcher;
+    if (!archive.mounted())
+        watcher.emplace(assetDirectory);
+
+    Engine::FixedTimestep timestep(Constants::tickRate, Constants::maxTicksPerFrame);
+    TickStats             stats;
 
-    sf::RenderWindow window;
-    initWindow(window);
+    // Only computed here from now on: the render thread applies them
+    auto const defaultView = window.getDefaultView();
+    auto       view        = defaultView;
+    auto       windowSize  = window.getSize();
+    Engine::Renderer renderer(window, options.uncapped);
 
-    sf::RenderTexture gameTexture;
-    Core::bAssert(gameTexture.create(window.getSize().x, window.getSize().y),
-                  "Failed to create game texture");
+    // The GL context is the render thread's from now on: so are uploads. Those made so far ran
+    // right away, on the main thread which owned it.
+    screenManager.loader().setUploader([&renderer](Engine::AssetLoader::Finish step) {
+        renderer.upload(std::move(step));
+    });
 
-    Engine::ScreenManager screenManager;
-    screenManager.push<Screens::SpaceMapScreen>();
+    Core::Profiler::nameThread("Main");
+    std::vector<Engine::Screen const *> shown; // By the last frame
 
     sf::Clock clock;
-    while (window.isOpen())
+    for (bool running = true; running; )
     {
-        auto const screen = screenManager.top();
+        renderer.check();
+        {
+            PROFILE_ZONE("Assets");
+            if (watcher)
+            {
+                // Reloaded fonts and textures are decoded by the loader, their GPU work handed
+                // to the render thread from update(). Fonts are then swapped in by their own.
+                for (auto const & path : watcher->poll())
+                {
+                    SPDLOG_DEBUG("{} changed", path.generic_string());
+                    static_cast<void>(fontManager.reload(path, screenManager.loader()));
+                    screenManager.reload(path);
+                }
+            }
+            screenManager.update();
+            fontManager.update();
+        }
+        auto screens = screenManager.active();
 
-        sf::Event event; // NOLINT
-        while (window.pollEvent(event))
+        bool toggleOverlay = false;
+        bool events        = false; // Input may change what's drawn, window events always do
         {
-            /**/ if (event.type == sf::Event::Closed)
-                window.close();
-            else if (event.type == sf::Event::Resized)
-                onWindowResize(window, sf::Vector2u(event.size.width, event.size.height));
+            PROFILE_ZONE("Events");
+            sf::Event event; // NOLINT
+            while (window.pollEvent(event))
+            {
+                events = true;
+                /**/ if (event.type == sf::Event::Closed)
+                    running = false;
+                else if (event.type == sf::Event::Resized)
+                {
+                    windowSize = { event.size.width, event.size.height };
+                    view       = onWindowResize(renderer, defaultView, windowSize);
+                }
+                else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3)
+                    toggleOverlay = !toggleOverlay;
 
-            screen->onEvent(event);
+                for (auto && screen : screens)
+                    screen->onEvent(event);
+            }
+        }
+
+        // Not while iterating over the screens. Once pushed, the overlay may still wait behind
+        // a loading screen: toggling it again only counts once it's shown.
+        if (toggleOverlay)
+        {
+            if (screenManager.isTop<Screens::ProfilerOverlay>())
+                screenManager.pop(renderer.published() + 1); // Drawn by the frames so far
+            else if (!screenManager.queued<Screens::ProfilerOverlay>())
+                screenManager.push<Screens::ProfilerOverlay>(fontManager);
+            screens = screenManager.active();
         }
 
-        screen->update(clock.restart());
+        auto const frameTime = clock.restart();
+        auto const ticks     = timestep.advance(frameTime);
+        for (auto i = ticks; i > 0; --i)
+        {
+            PROFILE_ZONE("Update");
+            for (auto && screen : screens)
+                screen->update(timestep.tick());
+        }
+
+        auto & frame = renderer.frame();
+        {
+            PROFILE_ZONE("Publish");
+            auto const pointers = std::views::transform(screens, [](auto const & screen) {
+                return static_cast<Engine::Screen const *>(screen.get());
+            });
+            auto const changed = !std::ranges::equal(pointers, shown);
+            if (changed)
+                shown.assign(pointers.begin(), pointers.end());
+            frame.dirty = events || changed
+                       || std::ranges::any_of(screens, [](auto && s) { return s->dirty(); });
+
+            for (auto && screen : screens)
+                screen->publish();
+            frame.screens.assign(pointers.begin(), pointers.end());
+        }
+        frame.view       = view;
+        frame.windowSize = windowSize;
+        frame.simulated  = Engine::Renderer::Clock::now();
+        frame.alpha      = timestep.alpha();
+        frame.tick       = timestep.tick();
+        renderer.publish();
+        screenManager.release(renderer.acquired());
+        fontManager.release(renderer.published(), renderer.acquired());
+
+        if (options.uncapped)
+            stats.add(frameTime, clock.getElapsedTime(), ticks, timestep.dropped());
+
+#ifdef DARKORBIT_PROFILING
+        if (auto const glyphs = fontManager.takeRasterizedGlyphs())
+            SPDLOG_DEBUG("{} glyph(s) rasterized this frame", glyphs);
+#endif
 
-        gameTexture.clear();
-        screen->draw(gameTexture);
-        gameTexture.display();
+        // Presenting is the render thread's business: only wait for the next tick
+        sf::sleep(timestep.untilNextTick());
+    }
+    spdlog::info("{} static frame(s) skipped", renderer.skippedFrames());
 
-        window.clear();
-        window.draw(sf::Sprite(gameTexture.getTexture()));
-        window.display();
+    if (!options.trace.empty())
+    {
+        Core::Profiler::exportChromeTrace(options.trace);
+        spdlog::info("Trace written to {}", options.trace.string());
     }
 }
 catch (std::exception const & e)
@@ -81,43 +255,126 @@ catch (std::exception const & e)
 
 namespace
 {
-    void configureLogging()
+    void TickStats::add(sf::Time frame, sf::Time tickCost, unsigned tickCount, sf::Time dropped)
+    {
+        elapsed += frame;
+        cost    += tickCost;
+        ticks   += tickCount;
+
+        if (elapsed < sf::seconds(1.f))
+            return;
+
+        spdlog::info("{} ticks | tick {:.3f} ms/tick, dropped {:.0f} ms", ticks,
+                     ticks ? cost.asSeconds() * 1000.f / static_cast<float>(ticks) : 0.f,
+                     dropped.asSeconds() * 1000.f);
+        *this = {};
+    }
+
+    auto parseOptions(std::span<char *> args) -> Options
+    {
+        Options options;
+        for (std::size_t i = 0; i < args.size(); ++i)
+        {
+            std::string_view const arg = args[i];
+
+            /**/ if (arg == "--uncapped")
+                options.uncapped = true;
+            else if (arg == "--trace" && i + 1 < args.size())
+            {
+                // Without zones, the trace would be written empty
+                if constexpr (Core::Profiler::enabled())
+                    options.trace = args[++i];
+                else
+                    spdlog::warn("Ignoring --trace {}: zones need a DARKORBIT_PROFILING build",
+                                 args[++i]);
+            }
+            else if (arg == "--server" && i + 1 < args.size())
+                options.server = args[++i];
+            else if (arg == "--log-level" && i + 1 < args.size())
+                options.logLevel = args[++i];
+            else
+                spdlog::warn("Ignoring unknown option '{}'", arg);
+        }
+        return options;
+    }
+
+    auto connect(Options const & options) -> std::unique_ptr<Net::Client>
     {
-//#ifndef NDEBUG
-        spdlog::set_level(spdlog::level::trace);
-//#endif
-        spdlog::set_pattern("%C-%m-%d %H:%M:%S.%e [%t] [%^%L%$] %v");
+        if (options.server.empty())
+        {
+            SPDLOG_DEBUG("No --server, playing offline");
+            return nullptr;
+        }
+
+        auto const colon = options.server.rfind(':');
+        auto const host  = options.server.substr(0, colon);
+        auto const port  = colon == std::string::npos ? Net::defaultPort
+                         : static_cast<std::uint16_t>(std::stoi(options.server.substr(colon + 1)));
+
+        spdlog::info("Connecting to {}:{}", host, port);
+        return std::make_unique<Net::Client>(host, port);
+    }
 
+    void configureLocale()
+    {
         // Needed for localized string format
         std::locale const currentLocale(getCurrentLocale());
         std::locale::global(currentLocale);
-        spdlog::trace("Current locale: {}", currentLocale.c_str());
+        Utils::setNumberLocale(currentLocale);
+        SPDLOG_TRACE("Current locale: {}", currentLocale.name());
     }
 
-    void initWindow(sf::Window & w)
+    void mountAssets(Engine::AssetArchive & archive)
+    {
+        if (archive.mount(assetArchive))
+            spdlog::info("Mounted {} ({} assets)", assetArchive, archive.size());
+        else
+            SPDLOG_DEBUG("No {}, using loose asset files", assetArchive);
+    }
+
+    void initWindow(sf::Window & w, Engine::AssetArchive const & archive, Options const & options)
     {
         auto const bitsDepth = sf::VideoMode::getDesktopMode().bitsPerPixel;
         w.create(sf::VideoMode(Constants::gameViewWidth, Constants::gameViewHeight, bitsDepth),
                  Constants::windowTitle, sf::Style::Default);
 
-        spdlog::trace("Enabling vertical sync");
-        w.setVerticalSyncEnabled(true);
+        if (options.uncapped)
+            spdlog::info("Uncapped rendering: vertical sync disabled");
+        else
+            SPDLOG_TRACE("Enabling vertical sync");
+        w.setVerticalSyncEnabled(!options.uncapped);
 
-        spdlog::trace("Loading application icon");
+        SPDLOG_TRACE("Loading application icon");
         constexpr auto path = "assets/favicon.png";
 
-        if (sf::Image icon; icon.loadFromFile(path))
+        if (auto const * entry = archive.find(path))
+        {
+            w.setIcon(entry->width, entry->height,
+                      reinterpret_cast<sf::Uint8 const *>(entry->data.data()));
+        }
+        else if (sf::Image icon; icon.loadFromFile(path))
             w.setIcon(icon.getSize().x, icon.getSize().y, icon.getPixelsPtr());
         else
             spdlog::warn("Failed to load application icon from '{}'", path);
     }
 
-    void onWindowResize(sf::RenderWindow & window, sf::Vector2u windowSize)
+    void loadFonts(Engine::FontManager & fontManager, Engine::AssetArchive const & archive)
+    {
+        SPDLOG_TRACE("Loading fonts");
+        fontManager.load("orbitron", "assets/font/orbitron-bold.ttf", archive);
+
+        // Plain and outlined HUD text
+        fontManager.prewarm("orbitron", Constants::fontSize, { 0.f, Constants::textOutline });
+    }
+
+    /// Returns the view for the render thread to use
+    auto onWindowResize(Engine::Renderer & renderer, sf::View const & defaultView,
+                        sf::Vector2u windowSize) -> sf::View
     {
         if (windowSize.x < Constants::gameViewWidth || windowSize.y < Constants::gameViewHeight)
         {
-            window.setSize(windowSize);
-            window.setView(window.getDefaultView());
+            renderer.resize(windowSize);
+            return defaultView;
         }
         else
         {
@@ -138,9 +395,9 @@ namespace
                 left  = (1 - width) / 2.f;
             }
 
-            auto view = window.getDefaultView();
+            auto view = defaultView;
             view.setViewport(sf::FloatRect(left, top, width, height));
-            window.setView(view);
+            return view;
         }
     }
 
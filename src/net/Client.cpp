@@ -0,0 +1,114 @@
+/// @file   Client.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "Client.hpp"
+
+// Project includes
+#include "Connection.hpp"
+#include "../core/Exception.hpp"
+#include "../core/Profiler.hpp"
+
+// Third-party includes
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/System/Sleep.hpp>
+#include <spdlog/spdlog.h>
+
+// C++ includes
+#include <utility>
+
+using namespace Net;
+
+namespace
+{
+    auto const connectTimeout = sf::seconds(2.f);
+    auto const retryDelay     = sf::seconds(1.f);
+    auto const pollTimeout    = sf::milliseconds(10); // How late a stop request can be noticed
+
+    /// Sleeps for @p duration, or less if a stop is requested
+    void sleepFor(std::stop_token const & stop, sf::Time duration)
+    {
+        for (; duration > sf::Time::Zero && !stop.stop_requested(); duration -= pollTimeout)
+            sf::sleep(pollTimeout);
+    }
+} // !namespace
+
+Client::Client(std::string host, std::uint16_t port)
+    : _host(std::move(host))
+    , _port(port)
+    , _thread([this](std::stop_token stop) { run(std::move(stop)); })
+{
+}
+
+auto Client::poll() -> std::optional<State>
+{
+    std::optional<State> latest;
+    while (auto update = _updates.pop())
+        latest = std::move(update->state);
+    return latest;
+}
+
+void Client::run(std::stop_token stop)
+{
+    Core::Profiler::nameThread("Network");
+
+    while (!stop.stop_requested())
+    {
+        Connection connection;
+        if (!connection.connect(_host, _port, connectTimeout))
+        {
+            SPDLOG_DEBUG("[Client] Failed to connect to {}:{}, retrying", _host, _port);
+            sleepFor(stop, retryDelay);
+            continue;
+        }
+
+        spdlog::info("[Client] Connected to {}:{}", _host, _port);
+        try
+        {
+            session(stop, connection);
+        }
+        catch (std::exception const & e)
+        {
+            spdlog::error("[Client] {}", Core::formatExceptionStack(e));
+        }
+
+        _connected = false;
+        connection.disconnect();
+        if (!stop.stop_requested())
+        {
+            spdlog::warn("[Client] Disconnected from {}:{}, reconnecting", _host, _port);
+            sleepFor(stop, retryDelay);
+        }
+    }
+}
+
+void Client::session(std::stop_token const & stop, Connection & connection)
+{
+    _connected = true;
+
+    sf::SocketSelector selector;
+    selector.add(connection.socket());
+
+    std::optional<Update> pending; // Kept until the simulation makes room for it
+    while (!stop.stop_requested() && connection.connected())
+    {
+        if (pending && _updates.push(*pending))
+            pending.reset();
+
+        if (!selector.wait(pollTimeout))
+            continue;
+
+        auto const bytes     = connection.receivedBytes();
+        auto const snapshots = connection.snapshots();
+        auto const changed   = connection.pump();
+        _receivedBytes += connection.receivedBytes() - bytes;
+        _snapshots     += connection.snapshots() - snapshots;
+        if (!changed)
+            continue;
+
+        // Only the latest state matters: an update that doesn't fit replaces the pending one
+        Update const update{ connection.state(), connection.tick() };
+        if (pending || !_updates.push(update))
+            pending = update;
+    }
+}
@@ -0,0 +1,62 @@
+/// @file   Client.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// Project includes
+#include "Protocol.hpp"
+#include "../core/SpscQueue.hpp"
+
+// C++ includes
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <thread>
+
+namespace Net { class Client; class Connection; }
+
+/// Connection to the game server, on its own I/O thread: the socket never blocks the
+/// simulation, which picks the latest state up with poll(). Reconnects until destroyed.
+class Net::Client final
+{
+private:
+    struct Update
+    {
+        State         state;
+        std::uint32_t tick = 0;
+    };
+
+private:
+    std::string   _host;
+    std::uint16_t _port;
+
+    Core::SpscQueue<Update, 16> _updates;
+    std::atomic<bool>           _connected     { false };
+    std::atomic<std::uint64_t>  _receivedBytes { 0 };
+    std::atomic<std::uint64_t>  _snapshots     { 0 };
+
+    std::jthread _thread; // Last: started once everything else is constructed
+
+public:
+    Client(std::string host, std::uint16_t port);
+
+    Client(Client const &)             = delete;
+    Client & operator=(Client const &) = delete;
+
+public:
+    /// Simulation thread: the most recent state received since the last call, if any
+    [[nodiscard]] auto poll() -> std::optional<State>;
+
+public:
+    [[nodiscard]] auto connected()     const -> bool          { return _connected.load();     }
+    [[nodiscard]] auto receivedBytes() const -> std::uint64_t { return _receivedBytes.load(); }
+    [[nodiscard]] auto snapshots()     const -> std::uint64_t { return _snapshots.load();     }
+
+private:
+    /// I/O thread
+    void run(std::stop_token stop);
+    void session(std::stop_token const & stop, Connection & connection);
+};
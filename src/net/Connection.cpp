@@ -0,0 +1,125 @@
+/// @file   Connection.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "Connection.hpp"
+
+// Project includes
+#include "../core/Exception.hpp"
+
+// C++ includes
+#include <vector>
+
+using namespace Net;
+
+namespace
+{
+    /// Snapshots are a handful of bytes: a small read buffer keeps idle connections cheap
+    constexpr std::size_t receiveSize = 1024;
+} // !namespace
+
+auto Connection::connect(std::string const & host, std::uint16_t port, sf::Time timeout) -> bool
+{
+    disconnect();
+    _socket.setBlocking(true);
+    if (_socket.connect(host, port, timeout) != sf::Socket::Done)
+        return false;
+
+    _socket.setBlocking(false);
+    return start();
+}
+
+auto Connection::beginConnect(sf::IpAddress const & address, std::uint16_t port,
+                              sf::Time timeout) -> bool
+{
+    disconnect();
+    _socket.setBlocking(false);
+
+    auto const status = _socket.connect(address, port);
+    if (status != sf::Socket::Done && status != sf::Socket::NotReady)
+        return false;
+
+    _connecting = true;
+    _deadline   = Clock::now() + std::chrono::microseconds(timeout.asMicroseconds());
+    return true;
+}
+
+void Connection::disconnect()
+{
+    if (_connected || _connecting)
+        _socket.disconnect();
+    _connected  = false;
+    _connecting = false;
+}
+
+auto Connection::start() -> bool
+{
+    std::vector<std::uint8_t> hello;
+    writeHello(hello);
+
+    // A few bytes into an empty send buffer: not sending them all at once is a failure
+    std::size_t sent = 0;
+    if (_socket.send(hello.data(), hello.size(), sent) != sf::Socket::Done)
+    {
+        _socket.disconnect();
+        return false;
+    }
+
+    _framer    = {};
+    _state     = {};
+    _tick      = 0;
+    _connected = true;
+    return true;
+}
+
+auto Connection::finishConnect() -> bool
+{
+    // Pending or refused connections have no peer yet: the deadline tells them apart
+    if (_socket.getRemoteAddress() == sf::IpAddress::None)
+    {
+        if (Clock::now() >= _deadline)
+            disconnect();
+        return false;
+    }
+
+    _connecting = false;
+    return start();
+}
+
+auto Connection::pump() -> bool
+{
+    if (_connecting && !finishConnect())
+        return false;
+
+    auto changed = false;
+    while (_connected)
+    {
+        std::size_t received = 0;
+        auto const  status   = _socket.receive(_framer.prepare(receiveSize), receiveSize, received);
+        if (status == sf::Socket::Disconnected || status == sf::Socket::Error)
+        {
+            disconnect();
+            break;
+        }
+
+        _framer.commit(received);
+        _receivedBytes += received;
+
+        while (auto message = _framer.next())
+        {
+            Reader     body(*message);
+            auto const type = static_cast<MessageType>(body.byte());
+            Core::bAssert(type == MessageType::Snapshot, "Unexpected message {}",
+                          static_cast<int>(type));
+
+            _tick = readSnapshot(body, _state);
+            ++_snapshots;
+            changed = true;
+        }
+
+        // Less than asked for: the socket is drained
+        if (status != sf::Socket::Done || received < receiveSize)
+            break;
+    }
+    return changed;
+}
@@ -0,0 +1,82 @@
+/// @file   Connection.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// Project includes
+#include "Protocol.hpp"
+
+// Third-party includes
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/System/Time.hpp>
+
+// C++ includes
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Net { class Connection; }
+
+/// Session with the game server, driven by the thread that owns it: connect() blocks, pump()
+/// and beginConnect() never do. Net::Client runs one on its own I/O thread; bots run thousands
+/// on a few threads.
+class Net::Connection final
+{
+private:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    sf::TcpSocket     _socket;
+    Framer            _framer;
+    State             _state;
+    std::uint32_t     _tick          = 0;
+    bool              _connected     = false;
+    bool              _connecting    = false; ///< Since beginConnect(), until connected or late
+    Clock::time_point _deadline;              ///< To be connected by
+    std::uint64_t _receivedBytes = 0;
+    std::uint64_t _snapshots     = 0;
+
+public:
+    Connection() = default;
+
+    Connection(Connection const &)             = delete;
+    Connection & operator=(Connection const &) = delete;
+
+public:
+    /// Connects and says hello, waiting up to @p timeout. False if the server can't be reached.
+    auto connect(std::string const & host, std::uint16_t port, sf::Time timeout) -> bool;
+
+    /// Starts connecting without blocking: pump() says hello once the socket is connected, or
+    /// gives up after @p timeout. False if it failed right away.
+    auto beginConnect(sf::IpAddress const & address, std::uint16_t port, sf::Time timeout)
+        -> bool;
+
+    void disconnect();
+
+    /// Decodes whatever the server sent, without blocking. True if state() changed. Throws on a
+    /// malformed message; connected() is false afterwards if the server went away.
+    auto pump() -> bool;
+
+public:
+    [[nodiscard]] auto connected()     const -> bool          { return _connected;     }
+    [[nodiscard]] auto connecting()    const -> bool          { return _connecting;    }
+    [[nodiscard]] auto state()         const -> State const & { return _state;         }
+    [[nodiscard]] auto tick()          const -> std::uint32_t { return _tick;          }
+    [[nodiscard]] auto receivedBytes() const -> std::uint64_t { return _receivedBytes; }
+    [[nodiscard]] auto snapshots()     const -> std::uint64_t { return _snapshots;     }
+
+    /// For a sf::SocketSelector
+    [[nodiscard]] auto socket() -> sf::TcpSocket & { return _socket; }
+
+    /// Heap bytes held, on top of sizeof(Connection); the OS's socket buffers aren't included
+    [[nodiscard]] auto memoryUsage() const -> std::size_t { return _framer.capacity(); }
+
+private:
+    /// Once the socket is connected: says hello and starts a new session
+    auto start() -> bool;
+    /// Whether a connection started by beginConnect() went through
+    auto finishConnect() -> bool;
+};
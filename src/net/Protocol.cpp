@@ -0,0 +1,197 @@
+/// @file   Protocol.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "Protocol.hpp"
+
+// Project includes
+#include "../core/Exception.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+using namespace Net;
+
+namespace
+{
+    constexpr std::uint8_t keyframeFlag = 0b1;
+
+    constexpr std::size_t maxVarintSize = 10;
+
+    auto encodeVarint(std::uint64_t value, std::uint8_t * out) -> std::uint8_t *
+    {
+        while (value >= 0x80)
+        {
+            *out++ = static_cast<std::uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+        *out++ = static_cast<std::uint8_t>(value);
+        return out;
+    }
+
+    /// Writes the length of what was appended to @p out since @p start in front of it
+    void frame(std::vector<std::uint8_t> & out, std::size_t start)
+    {
+        std::uint8_t length[maxVarintSize];
+        auto const   end = encodeVarint(out.size() - start, length);
+        out.insert(out.begin() + static_cast<std::ptrdiff_t>(start), length, end);
+    }
+
+    /// A State's fields, in forEachField() order
+    struct Fields
+    {
+        std::array<std::uint64_t, 64> values{};
+        unsigned                      count = 0;
+    };
+
+    auto fields(State const & state) -> Fields
+    {
+        Fields f;
+        forEachField(state, [&](auto value) { f.values[f.count++] = value; });
+        return f;
+    }
+} // !namespace
+
+void Net::writeVarint(std::vector<std::uint8_t> & out, std::uint64_t value)
+{
+    std::uint8_t bytes[maxVarintSize];
+    out.insert(out.end(), bytes, encodeVarint(value, bytes));
+}
+
+auto Reader::byte() -> std::uint8_t
+{
+    Core::bAssert(!_bytes.empty(), "Truncated message");
+    auto const value = _bytes.front();
+    _bytes = _bytes.subspan(1);
+    return value;
+}
+
+auto Reader::varint() -> std::uint64_t
+{
+    std::uint64_t value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+        auto const b = byte();
+        value |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+        if (!(b & 0x80))
+            return value;
+    }
+    throw Core::Exception("Varint longer than 64 bits");
+}
+
+void Net::writeHello(std::vector<std::uint8_t> & out)
+{
+    auto const start = out.size();
+    out.push_back(static_cast<std::uint8_t>(MessageType::Hello));
+    writeVarint(out, protocolMagic);
+    writeVarint(out, protocolVersion);
+    frame(out, start);
+}
+
+void Net::readHello(Reader & body)
+{
+    auto const magic   = body.varint();
+    auto const version = body.varint();
+    Core::bAssert(magic == protocolMagic, "Not a Dark Orbit client");
+    Core::bAssert(version == protocolVersion, "Unsupported protocol version {}", version);
+}
+
+void Net::writeSnapshot(std::vector<std::uint8_t> & out, State const & state,
+                        State const & baseline, std::uint32_t tick, bool keyframe)
+{
+    auto const current  = fields(state);
+    auto const previous = fields(baseline);
+
+    std::uint64_t mask = 0;
+    for (unsigned i = 0; i < current.count; ++i)
+    {
+        if (current.values[i] != previous.values[i])
+            mask |= std::uint64_t(1) << i;
+    }
+
+    auto const start = out.size();
+    out.push_back(static_cast<std::uint8_t>(MessageType::Snapshot));
+    out.push_back(keyframe ? keyframeFlag : 0);
+    writeVarint(out, tick);
+    writeVarint(out, mask);
+    for (unsigned i = 0; i < current.count; ++i)
+    {
+        // Differences are taken modulo 2^64, so that every field width round-trips
+        if (mask & (std::uint64_t(1) << i))
+            writeVarint(out, zigzag(static_cast<std::int64_t>(current.values[i]
+                                                            - previous.values[i])));
+    }
+    frame(out, start);
+}
+
+auto Net::readSnapshot(Reader & body, State & state) -> std::uint32_t
+{
+    auto const flags = body.byte();
+    auto const tick  = static_cast<std::uint32_t>(body.varint());
+    auto const mask  = body.varint();
+
+    if (flags & keyframeFlag)
+        state = {};
+
+    unsigned field = 0;
+    forEachField(state, [&](auto & value) {
+        if (mask & (std::uint64_t(1) << field++))
+        {
+            using T = std::remove_reference_t<decltype(value)>;
+            auto const delta = static_cast<std::uint64_t>(unzigzag(body.varint()));
+            value = static_cast<T>(static_cast<std::uint64_t>(value) + delta);
+        }
+    });
+    Core::bAssert(mask >> field == 0, "Unknown fields in snapshot");
+    return tick;
+}
+
+auto Framer::prepare(std::size_t size) -> std::uint8_t *
+{
+    // Drop what was already consumed before growing
+    if (_read > 0)
+    {
+        std::copy(_buffer.begin() + static_cast<std::ptrdiff_t>(_read),
+                  _buffer.begin() + static_cast<std::ptrdiff_t>(_written), _buffer.begin());
+        _written -= _read;
+        _read     = 0;
+    }
+
+    if (_buffer.size() < _written + size)
+        _buffer.resize(_written + size);
+    return _buffer.data() + _written;
+}
+
+void Framer::commit(std::size_t size)
+{
+    _written += size;
+}
+
+auto Framer::next() -> std::optional<std::span<std::uint8_t const>>
+{
+    std::span<std::uint8_t const> const available(_buffer.data() + _read, _written - _read);
+
+    // Length prefix
+    std::uint64_t length = 0;
+    std::size_t   prefix = 0;
+    for (unsigned shift = 0;; shift += 7)
+    {
+        if (prefix == available.size())
+            return std::nullopt;
+        Core::bAssert(shift < 64, "Malformed frame length");
+
+        auto const b = available[prefix++];
+        length |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+        if (!(b & 0x80))
+            break;
+    }
+    Core::bAssert(length > 0 && length <= maxMessageSize, "Invalid message size {}", length);
+
+    if (available.size() - prefix < length)
+        return std::nullopt;
+
+    _read += prefix + length;
+    return available.subspan(prefix, length);
+}
@@ -0,0 +1,124 @@
+/// @file   Protocol.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Client/server wire protocol, over TCP. Every message is framed as a varint byte length
+/// followed by a one byte MessageType and its body:
+///   Hello    (client) varint magic, varint version
+///   Snapshot (server) byte flags, varint tick, varint mask of the fields that changed, then for
+///                     each of them the zigzag varint difference from the previous snapshot.
+///                     A keyframe is a difference from a default-constructed State.
+/// Stats rarely change all at once and rarely by much, so a steady-state snapshot is a handful
+/// of bytes.
+
+#pragma once
+
+// Project includes
+#include "../game/PlayerStats.hpp"
+#include "../game/ShipStats.hpp"
+
+// C++ includes
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Net
+{
+    constexpr std::uint16_t defaultPort     = 4242;
+    constexpr std::uint32_t protocolMagic   = 0x4F44; // "DO"
+    constexpr std::uint32_t protocolVersion = 1;
+    constexpr std::size_t   maxMessageSize  = 1 << 16;
+
+    enum class MessageType : std::uint8_t { Hello = 1, Snapshot = 2 };
+
+    /// What the server is authoritative for
+    struct State
+    {
+        Game::PlayerStats player;
+        Game::ShipStats   ship;
+    };
+
+    /// Calls @p f on every field of @p state, always in the same order: a field's rank is its bit
+    /// in the snapshot mask
+    template<typename S, typename F>
+    void forEachField(S & state, F && f);
+
+    // Varints -------------------------------------------------------------------------------------
+
+    /// Little-endian base 128: 7 bits per byte, high bit set on all bytes but the last
+    void writeVarint(std::vector<std::uint8_t> & out, std::uint64_t value);
+
+    /// Maps small negative and positive numbers alike to small unsigned ones
+    [[nodiscard]] constexpr auto zigzag(std::int64_t value) -> std::uint64_t
+    {
+        return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+    }
+
+    [[nodiscard]] constexpr auto unzigzag(std::uint64_t value) -> std::int64_t
+    {
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    /// Reads a message body. Throws on truncated or malformed input.
+    class Reader
+    {
+    private:
+        std::span<std::uint8_t const> _bytes;
+
+    public:
+        explicit Reader(std::span<std::uint8_t const> bytes) noexcept : _bytes(bytes) {}
+
+        auto byte()   -> std::uint8_t;
+        auto varint() -> std::uint64_t;
+
+        [[nodiscard]] auto empty() const -> bool { return _bytes.empty(); }
+    };
+
+    // Messages ------------------------------------------------------------------------------------
+
+    /// Appends a framed Hello
+    void writeHello(std::vector<std::uint8_t> & out);
+    /// Throws if the client doesn't speak our protocol
+    void readHello(Reader & body);
+
+    /// Appends a framed Snapshot of @p state, as a difference from @p baseline
+    void writeSnapshot(std::vector<std::uint8_t> & out, State const & state,
+                       State const & baseline, std::uint32_t tick, bool keyframe);
+    /// Applies a Snapshot to @p state, which must be the previous snapshot (or a default State for
+    /// a keyframe). Returns its tick.
+    auto readSnapshot(Reader & body, State & state) -> std::uint32_t;
+
+    /// Accumulates received bytes and splits them into messages
+    class Framer
+    {
+    private:
+        std::vector<std::uint8_t> _buffer;
+        std::size_t               _read    = 0; ///< Start of the first unconsumed byte
+        std::size_t               _written = 0; ///< End of the received bytes
+
+    public:
+        /// Room for @p size more bytes: write into it, then commit() what was written
+        auto prepare(std::size_t size) -> std::uint8_t *;
+        void commit (std::size_t size);
+
+        /// Next complete message (type byte and body), valid until the next prepare(). Throws if
+        /// the frame is larger than maxMessageSize.
+        auto next() -> std::optional<std::span<std::uint8_t const>>;
+
+        [[nodiscard]] auto capacity() const -> std::size_t { return _buffer.capacity(); }
+    };
+} // !namespace Net
+
+template<typename S, typename F>
+inline void Net::forEachField(S & state, F && f)
+{
+    auto & p = state.player;
+    auto & s = state.ship;
+
+    f(p.xp); f(p.honor); f(p.credits); f(p.uridium); f(p.jackpot); f(p.level);
+    f(s.curHp); f(s.curShield); f(s.curAmmo); f(s.curCargo);
+    f(s.maxHp); f(s.maxShield); f(s.maxAmmo); f(s.maxCargo);
+    f(s.curRockets); f(s.maxRockets);
+}
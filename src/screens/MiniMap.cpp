@@ -0,0 +1,161 @@
+/// @file   MiniMap.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "MiniMap.hpp"
+
+// Project includes
+#include "../core/Constants.hpp"
+#include "../core/Result.hpp"
+#include "../core/Profiler.hpp"
+
+// Third-party includes
+#include <SFML/Graphics/RenderTarget.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <cmath>
+
+using namespace Screens;
+
+namespace
+{
+    constexpr auto refreshRate = 0.1f; // Seconds between two dot refreshes
+    constexpr auto dotSize     = 2.f;
+
+    auto color(Game::Faction faction) -> sf::Color
+    {
+        switch (faction)
+        {
+            case Game::Faction::Player: return sf::Color::White;
+            case Game::Faction::Ally:   return sf::Color(80, 220, 80);
+            case Game::Faction::Enemy:  return sf::Color(230, 60, 60);
+            case Game::Faction::Alien:  return sf::Color(230, 150, 60);
+        }
+        return sf::Color::Magenta;
+    }
+} // !namespace
+
+void MiniMap::setBackground(sf::Sprite const & background)
+{
+    auto const bounds = background.getLocalBounds();
+    _background = background;
+    _scale      = { bounds.width  / Constants::mapWidth, bounds.height / Constants::mapHeight };
+    _dots.clear(); // Rewritten on the next refresh
+    _dotVersions.clear();
+    _sinceRefresh = sf::seconds(refreshRate);
+    ++_version;
+}
+
+void MiniMap::update(sf::Time const & elapsed, Game::EntityStore const & entities,
+                     Game::EntityId player)
+{
+    _sinceRefresh += elapsed;
+    if (_sinceRefresh.asSeconds() < refreshRate)
+        return;
+
+    _sinceRefresh = sf::Time::Zero;
+    refresh(entities, player);
+}
+
+void MiniMap::refresh(Game::EntityStore const & entities, Game::EntityId player)
+{
+    PROFILE_ZONE("Mini-map refresh");
+
+    auto const & ships  = entities.ships();
+    auto const   count  = ships.ids.size();
+    auto const   bounds = _background.getLocalBounds();
+
+    auto const resized = _dots.getVertexCount() != count * 4;
+    auto       changed = resized;
+    auto const version = _version + 1; // Of the quads rewritten below
+    _dots.resize(count * 4);
+    _dotVersions.resize(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        // Whole pixels: a ship only costs a rewrite once its dot actually moves
+        sf::Vector2f const dot(
+            std::floor(std::clamp(ships.motion.x[i] * _scale.x, 0.f, bounds.width  - dotSize)),
+            std::floor(std::clamp(ships.motion.y[i] * _scale.y, 0.f, bounds.height - dotSize)));
+        auto const tint = color(ships.faction[i]);
+
+        auto * quad = &_dots[i * 4];
+        if (!resized && quad[0].position == dot && quad[0].color == tint)
+            continue;
+
+        quad[0] = { dot,                                  tint };
+        quad[1] = { dot + sf::Vector2f(dotSize, 0.f),     tint };
+        quad[2] = { dot + sf::Vector2f(dotSize, dotSize), tint };
+        quad[3] = { dot + sf::Vector2f(0.f,     dotSize), tint };
+        _dotVersions[i] = version;
+        changed = true;
+    }
+
+    if (changed)
+        _version = version;
+
+    if (entities.alive(player))
+    {
+        auto const row = entities.row(player);
+        _position = { static_cast<unsigned>(std::max(ships.motion.x[row], 0.f) / 100.f),
+                      static_cast<unsigned>(std::max(ships.motion.y[row], 0.f) / 100.f) };
+    }
+}
+
+void MiniMap::publish()
+{
+    auto & frame = _frames.back();
+    if (frame.version != _version)
+    {
+        // A resize rewrote every quad: those are all newer than the frame
+        frame.background = _background;
+        frame.dots.resize(_dots.getVertexCount());
+        for (std::size_t i = 0; i < _dotVersions.size(); ++i)
+        {
+            if (_dotVersions[i] <= frame.version)
+                continue;
+            for (std::size_t v = i * 4; v < i * 4 + 4; ++v)
+                frame.dots[v] = _dots[v];
+        }
+        frame.version = _version;
+    }
+    _frames.publish();
+}
+
+void MiniMap::draw(sf::RenderTarget & target, sf::RenderStates states) const
+{
+    PROFILE_ZONE("Mini-map draw");
+
+    auto const & frame = _frames.acquire();
+    if (!frame.background.getTexture())
+        return; // Not laid out yet
+
+    if (frame.version != _layerVersion)
+    {
+        auto const bounds = frame.background.getLocalBounds();
+        auto const width  = static_cast<unsigned>(bounds.width);
+        auto const height = static_cast<unsigned>(bounds.height);
+        if (!_layer || _layer->getSize() != sf::Vector2u(width, height))
+        {
+            _layer.emplace();
+            if (!_layer->create(width, height)) [[unlikely]]
+                MAKE_ERROR("Failed to create the {}x{} mini-map layer", width, height).raise();
+        }
+
+        auto background = frame.background;
+        background.setPosition(0.f, 0.f);
+
+        _layer->clear(sf::Color::Transparent);
+        _layer->draw(background);
+        _layer->draw(frame.dots);
+        _layer->display();
+        Core::Profiler::countDrawCalls(2);
+        _layerVersion = frame.version;
+    }
+
+    sf::Sprite layer(_layer->getTexture());
+    layer.setPosition(frame.background.getPosition());
+    target.draw(layer, states);
+    Core::Profiler::countDrawCalls();
+}
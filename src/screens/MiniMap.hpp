@@ -0,0 +1,77 @@
+/// @file   MiniMap.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// Project includes
+#include "../core/TripleBuffer.hpp"
+#include "../game/EntityStore.hpp"
+
+// third-party includes
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/System/Time.hpp>
+
+// C++ includes
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace Screens { class MiniMap; }
+
+/// Mini-map: its background and one dot per ship, composed into a layer that is only redrawn
+/// when a dot moved. Dots are refreshed a few times per second rather than every tick, and only
+/// the vertices of the ships that moved by a pixel or more are rewritten, then handed over to
+/// the render thread. Every other frame draws the layer as a single quad.
+class Screens::MiniMap final : public sf::Drawable
+{
+private:
+    /// What the render thread draws. Only the dots that changed since it was last handed over
+    /// are copied again.
+    struct Frame
+    {
+        std::size_t     version = 0;
+        sf::Sprite      background;
+        sf::VertexArray dots{ sf::Quads };
+    };
+
+private:
+    sf::Sprite               _background;
+    sf::Vector2f             _scale;             ///< Map units to mini-map pixels
+    sf::VertexArray          _dots{ sf::Quads }; ///< 4 vertices per ship, in ship table order
+    std::vector<std::size_t> _dotVersions;       ///< Per ship: _version its quad last changed at
+    sf::Time                 _sinceRefresh;
+    sf::Vector2u             _position;          ///< Of the player, in hundreds of map units
+    std::size_t              _version = 1;
+
+    mutable Core::TripleBuffer<Frame>        _frames;  // Consumed from draw()
+    mutable std::optional<sf::RenderTexture> _layer;   // Render thread only
+    mutable std::size_t                      _layerVersion = 0;
+
+public:
+    /// Where and what the mini-map shows
+    void setBackground(sf::Sprite const & background);
+
+    /// Refreshes the dots from @p entities when due
+    void update(sf::Time const & elapsed, Game::EntityStore const & entities,
+                Game::EntityId player);
+
+    /// Hands the current dots over to draw()
+    void publish();
+
+public:
+    /// Player's position as shown next to the mini-map, changing at the mini-map's refresh rate
+    [[nodiscard]] auto position() const -> sf::Vector2u const & { return _position; }
+
+    /// Changes whenever the dots do
+    [[nodiscard]] auto version()  const -> std::size_t          { return _version;  }
+
+private:
+    void refresh(Game::EntityStore const & entities, Game::EntityId player);
+
+    /// Render thread
+    void draw(sf::RenderTarget & target, sf::RenderStates states) const override;
+};
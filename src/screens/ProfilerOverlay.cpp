@@ -0,0 +1,220 @@
+/// @file   ProfilerOverlay.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "ProfilerOverlay.hpp"
+
+// Project includes
+#include "../core/Profiler.hpp"
+#include "../engine/FontManager.hpp"
+#include "../utils/SfmlText.hpp"
+
+// Third-party includes
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+// C++ includes
+#include <algorithm>
+#include <map>
+#include <string_view>
+#include <vector>
+
+using namespace Screens;
+using namespace Utils;
+
+namespace
+{
+    constexpr auto left        = 8.f;
+    constexpr auto top         = 48.f;
+    constexpr auto graphWidth  = 256;  // One pixel per frame
+    constexpr auto graphHeight = 64.f;
+    constexpr auto msToPixels  = 2.f;  // 32 ms tall
+    constexpr auto lineHeight  = 11.f;
+    constexpr auto budget      = 1000.f / 60.f;
+
+    constexpr auto refreshRate = 0.25f; // Seconds between two text refreshes, to keep them readable
+
+    void appendQuad(sf::VertexArray & vertices, sf::FloatRect const & rect, sf::Color color)
+    {
+        vertices.append({ { rect.left,              rect.top               }, color });
+        vertices.append({ { rect.left + rect.width, rect.top               }, color });
+        vertices.append({ { rect.left + rect.width, rect.top + rect.height }, color });
+        vertices.append({ { rect.left,              rect.top + rect.height }, color });
+    }
+
+    /// @p values must be sorted
+    auto percentile(std::vector<float> const & values, float p) -> float
+    {
+        if (values.empty())
+            return 0.f;
+        auto const index = static_cast<std::size_t>(p * static_cast<float>(values.size() - 1));
+        return values[index];
+    }
+} // !namespace
+
+ProfilerOverlay::ProfilerOverlay(Engine::FontManager const & fontManager) noexcept
+    : _fontManager(fontManager)
+    , _hud(fontManager)
+    , _graph(sf::Quads)
+{
+}
+
+void ProfilerOverlay::enter()
+{
+    refreshLines();
+    buildTexts();
+}
+
+void ProfilerOverlay::update(sf::Time const & elapsed)
+{
+    // Only the current font is pre-warmed: refresh() would reject the reloaded one
+    if (_fontManager.version() != _builtFonts)
+        buildTexts();
+    buildGraph();
+
+    _sinceRefresh += elapsed;
+    if (_sinceRefresh.asSeconds() >= refreshRate)
+    {
+        refreshLines();
+        _sinceRefresh = sf::Time::Zero;
+    }
+
+    _hud.refresh();
+}
+
+void ProfilerOverlay::publish()
+{
+    // The previous font is released after this frame
+    if (_fontManager.version() != _builtFonts)
+    {
+        buildTexts();
+        _hud.refresh();
+    }
+
+    _graphs.back() = _graph;
+    _graphs.publish();
+    _hud.publish();
+}
+
+void ProfilerOverlay::draw(sf::RenderTarget & target, sf::RenderStates states) const
+{
+    target.draw(_graphs.acquire(), states);
+    Core::Profiler::countDrawCalls();
+    target.draw(_hud, states);
+}
+
+void ProfilerOverlay::buildTexts()
+{
+    auto const & font = _fontManager.font("orbitron");
+    _builtFonts = _fontManager.version();
+
+    _hud.clear();
+    for (std::size_t i = 0; i < lineCount; ++i)
+    {
+        auto & text = _hud.add(makeText(font, ""));
+        text.setPosition(left + 4.f, top + graphHeight + 8.f + lineHeight * static_cast<float>(i));
+        _hud.bind([this, &text, &line = _lines[i]] {
+            setString(text, line);
+            _hud.changed(text);
+        }, _lines[i]);
+    }
+}
+
+void ProfilerOverlay::buildGraph()
+{
+    auto const frames = Core::Profiler::frames();
+    auto const count  = std::min(frames.size(), std::size_t(graphWidth));
+    auto const height = graphHeight + 12.f + lineHeight * lineCount;
+
+    _graph.clear();
+    appendQuad(_graph, { left, top, graphWidth + 8.f, height }, sf::Color(0, 0, 0, 160));
+
+    auto const bottom = top + 4.f + graphHeight;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto const ms    = frames[frames.size() - count + i].milliseconds;
+        auto const bar   = std::min(ms * msToPixels, graphHeight);
+        auto const color = ms <= budget * 1.05f ? sf::Color(80, 220, 80)
+                         : ms <= budget * 2.f   ? sf::Color(230, 200, 60)
+                         :                        sf::Color(230, 60, 60);
+        appendQuad(_graph, { left + 4.f + static_cast<float>(i), bottom - bar, 1.f, bar }, color);
+    }
+
+    // 60 fps budget
+    appendQuad(_graph, { left + 4.f, bottom - budget * msToPixels, graphWidth, 1.f },
+               sf::Color(255, 255, 255, 120));
+}
+
+void ProfilerOverlay::refreshLines()
+{
+    auto const frames = Core::Profiler::frames();
+
+    std::vector<float> times;
+    times.reserve(frames.size());
+    std::uint64_t drawCalls = 0, allocations = 0, bytes = 0, rebuilt = 0, rebuilding = 0;
+    for (auto && frame : frames)
+    {
+        times.push_back(frame.milliseconds);
+        drawCalls   += frame.drawCalls;
+        allocations += frame.allocations;
+        bytes       += frame.allocatedBytes;
+        rebuilt     += frame.rebuiltWidgets;
+        rebuilding  += frame.rebuiltWidgets > 0;
+    }
+    std::sort(times.begin(), times.end());
+
+    auto const frameCount = std::max<std::uint64_t>(frames.size(), 1);
+    auto const mean       = [&](std::uint64_t total) { return total / frameCount; };
+
+    _lines.fill({});
+    _lines[0] = fmt::format("Frame  p50 {:.2f}  p95 {:.2f}  p99 {:.2f}  max {:.2f} ms",
+                            percentile(times, .5f), percentile(times, .95f),
+                            percentile(times, .99f), times.empty() ? 0.f : times.back());
+
+    if constexpr (!Core::Profiler::enabled())
+    {
+        _lines[1] = "Counters and zones need a DARKORBIT_PROFILING build";
+        return;
+    }
+
+    _lines[1] = fmt::format("Draw calls {} / frame   Allocations {} / frame ({} bytes)",
+                            mean(drawCalls), mean(allocations), mean(bytes));
+
+    // Static frames should rebuild nothing: these lines' own refreshes are the floor
+    _lines[2] = fmt::format("Rebuilt widgets {:.2f} / frame, in {} of {} frames",
+                            static_cast<float>(rebuilt) / static_cast<float>(frameCount),
+                            rebuilding, frames.size());
+
+    // Costliest zones over the last second
+    struct Stat
+    {
+        float    total = 0.f;
+        float    max   = 0.f;
+        unsigned count = 0;
+    };
+
+    auto const since = Core::Profiler::Clock::now() - std::chrono::seconds(1);
+    std::map<std::string_view, Stat> stats;
+    for (auto && zone : Core::Profiler::zones())
+    {
+        if (zone.end < since)
+            continue;
+
+        auto const ms = std::chrono::duration<float, std::milli>(zone.end - zone.begin).count();
+        auto & stat = stats[zone.name];
+        stat.total += ms;
+        stat.max    = std::max(stat.max, ms);
+        ++stat.count;
+    }
+
+    std::vector<std::pair<std::string_view, Stat>> sorted(stats.begin(), stats.end());
+    std::sort(sorted.begin(), sorted.end(),
+              [](auto & lhs, auto & rhs) { return lhs.second.total > rhs.second.total; });
+
+    for (std::size_t i = 3; i < lineCount && i - 3 < sorted.size(); ++i)
+    {
+        auto && [name, stat] = sorted[i - 3];
+        _lines[i] = fmt::format("{}  avg {:.3f}  max {:.3f} ms  x{}", name,
+                                stat.total / static_cast<float>(stat.count), stat.max, stat.count);
+    }
+}
@@ -0,0 +1,56 @@
+/// @file   ProfilerOverlay.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// Project includes
+#include "../core/TripleBuffer.hpp"
+#include "../engine/Hud.hpp"
+#include "../engine/Screen.hpp"
+
+// third-party includes
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/System/Time.hpp>
+
+// C++ includes
+#include <array>
+#include <string>
+
+namespace Engine  { class FontManager;     }
+namespace Screens { class ProfilerOverlay; }
+
+/// Frame-time graph, percentiles, draw calls, allocations, rebuilt HUD widgets and the costliest
+/// profiler zones, drawn over the running screen
+class Screens::ProfilerOverlay final : public Engine::Screen
+{
+private:
+    static constexpr std::size_t lineCount = 10;
+
+private:
+    Engine::FontManager const &        _fontManager;
+    Engine::Hud                        _hud;
+    std::size_t                        _builtFonts = 0; ///< Font version the texts were made with
+    std::array<std::string, lineCount> _lines;
+    sf::Time                           _sinceRefresh;
+    sf::VertexArray                    _graph;
+
+    mutable Core::TripleBuffer<sf::VertexArray> _graphs; // Consumed from draw()
+
+public:
+    explicit ProfilerOverlay(Engine::FontManager const & fontManager) noexcept;
+
+public:
+    void enter() override;
+    [[nodiscard]] auto overlay() const -> bool override { return true; }
+
+public:
+    void update (sf::Time const & elapsed) override;
+    void publish()                         override;
+    void draw(sf::RenderTarget & target, sf::RenderStates states) const override;
+
+private:
+    void buildTexts();
+    void buildGraph();
+    void refreshLines();
+};
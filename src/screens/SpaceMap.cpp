@@ -7,283 +7,326 @@
 // Project includes
 #include "../core/Constants.hpp"
 #include "../core/Exception.hpp"
-#include "../game/Formulas.hpp"
+#include "../core/Profiler.hpp"
+#include "../engine/AssetLoader.hpp"
+#include "../engine/FontManager.hpp"
+#include "../net/Client.hpp"
 #include "../utils/SfmlText.hpp"
 
 // Third-party includes
-#include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Text.hpp>
-#include <SFML/Window/Event.hpp>
+#include <SFML/System/Time.hpp>
 #include <spdlog/spdlog.h>
 
+// C++ includes
+#include <filesystem>
+#include <string_view>
+
 using namespace Screens;
 using namespace Utils;
 
-SpaceMapScreen::SpaceMapScreen() noexcept
+namespace
+{
+    /// Written by the DarkOrbitAtlas tool (`atlas` build target), possibly archived by
+    /// DarkOrbitPack (`pak` target). Packed at load time if missing.
+    constexpr auto uiAtlas = "assets/atlas/ui.atlas";
+
+    /// Where the HUD's widgets go, see Engine::Layout
+    constexpr auto hudLayout = "assets/layout/spacemap.layout";
+
+    auto gameViewSize() -> sf::Vector2f
+    {
+        return { static_cast<float>(Constants::gameViewWidth),
+                 static_cast<float>(Constants::gameViewHeight) };
+    }
+} // !namespace
+
+SpaceMapScreen::SpaceMapScreen(Engine::FontManager const & fontManager, Net::Client * client)
+    : _fontManager(fontManager), _client(client), _hud(fontManager), _layout(gameViewSize())
+{
+}
+
+void SpaceMapScreen::load(Engine::AssetLoader & loader) try
+{
+    _layout.load(hudLayout, loader.archive());
+
+    SPDLOG_TRACE("[SpaceMap] Loading textures");
+    if (loader.exists(uiAtlas))
+        _textureManager.loadAtlas(uiAtlas, loader);
+
+    auto const load = [&](std::string name, char const * file) {
+        auto const path = std::filesystem::path("assets/ui") / file;
+        return _textureManager.load(std::move(name), path, loader);
+    };
+
+    _textures.header             = load("header",                "header.png");
+    _textures.ammoRocketAmountBg = load("ammo_rocket_amount_bg", "ammo_rocket_amount_bg.png");
+    _textures.hpAmountBg         = load("hp_amount_bg",          "hit_points_amount_bg.png");
+    _textures.shieldAmountBg     = load("shield_amount_bg",      "shield_amount_bg.png");
+    _textures.miniMap            = load("mini-map",              "mini-map.jpg");
+    _textures.miniMapHeader      = load("mini-map_header",       "mini-map_header.png");
+    _textures.configLabel        = load("config_label",          "configuration_label_bg.png");
+    _textures.configActive       = load("config_active",         "configuration_active.png");
+    _textures.configInactive     = load("config_inactive",       "configuration_inactive.png");
+    _textures.inventoryRight     = load("inventory_right",       "inventory_right.jpg");
+    _textures.inventoryCenter    = load("inventory_center",      "inventory_center.jpg");
+    _textures.inventoryLeft      = load("inventory_left",        "inventory_left.png");
+    _textures.inventoryTriangle  = load("inventory_triangle",    "inventory_triangle.png");
+    _textures.inventoryContentBg = load("inventory_content_bg",  "inventory_content_bg.png");
+
+    loader.then("[SpaceMap] Texture atlas", [this, &loader] {
+        _textureManager.pack(loader);
+        SPDLOG_TRACE("[SpaceMap] Loading done");
+    });
+}
+catch (...)
 {
-    _player.level = Formulas::getLevelFromXp(_player.xp);
+    THROW_NESTED("Failed to load space map");
 }
 
 void SpaceMapScreen::enter() try
 {
-    spdlog::trace("[SpaceMap] Loading textures");
-    _textureManager.load("header",                "assets/ui/header.png");
-    _textureManager.load("ammo_rocket_amount_bg", "assets/ui/ammo_rocket_amount_bg.png");
-    _textureManager.load("hp_amount_bg",          "assets/ui/hit_points_amount_bg.png");
-    _textureManager.load("shield_amount_bg",      "assets/ui/shield_amount_bg.png");
-    _textureManager.load("mini-map",              "assets/ui/mini-map.jpg");
-    _textureManager.load("mini-map_header",       "assets/ui/mini-map_header.png");
-    _textureManager.load("config_label",          "assets/ui/configuration_label_bg.png");
-    _textureManager.load("config_active",         "assets/ui/configuration_active.png");
-    _textureManager.load("config_inactive",       "assets/ui/configuration_inactive.png");
-    _textureManager.load("inventory_right",       "assets/ui/inventory_right.jpg");
-    _textureManager.load("inventory_center",      "assets/ui/inventory_center.jpg");
-    _textureManager.load("inventory_left",        "assets/ui/inventory_left.png");
-    _textureManager.load("inventory_triangle",    "assets/ui/inventory_triangle.png");
-    _textureManager.load("inventory_content_bg",  "assets/ui/inventory_content_bg.png");
-    spdlog::trace("[SpaceMap] Loading done");
+    buildHud();
 }
 catch (...)
 {
-    spdlog::error("[SpaceMap] Failed to load textures");
+    THROW_NESTED("Failed to enter space map");
 }
 
-void SpaceMapScreen::onEvent(sf::Event const & event)
+void SpaceMapScreen::reload(std::filesystem::path const & path, Engine::AssetLoader & loader)
 {
-    if (event.type == sf::Event::MouseMoved)
+    if (path.generic_string() != hudLayout)
+    {
+        // Uploaded on the render thread: update() sees the new version from pump()
+        if (_textureManager.reload(path, loader))
+            SPDLOG_DEBUG("[SpaceMap] Reloading {}", path.generic_string());
+        return;
+    }
+
+    // A broken layout is reported and the previous one kept
+    auto previous = std::move(_layout);
+    try
+    {
+        _layout = Engine::Layout(gameViewSize());
+        _layout.load(path, loader.archive());
+        buildHud();
+        spdlog::info("[SpaceMap] Reloaded {}", hudLayout);
+    }
+    catch (std::exception const & e)
     {
-        _miniMapPos.x = event.mouseMove.x;
-        _miniMapPos.y = event.mouseMove.y;
+        spdlog::warn("[SpaceMap] Keeping the previous layout: {}", Core::formatExceptionStack(e));
+        _layout = std::move(previous);
+        buildHud();
     }
 }
 
-void SpaceMapScreen::draw(sf::RenderTarget & target, sf::RenderStates) const try
+void SpaceMapScreen::update(sf::Time const & elapsed)
 {
-    auto header = _textureManager.sprite("header");
-
-    auto miniMap = _textureManager.sprite("mini-map");
-    miniMap.setPosition(target.getSize().x - miniMap.getLocalBounds().width,
-                        target.getSize().y - miniMap.getLocalBounds().height);
-
-    auto miniMapHeader = _textureManager.sprite("mini-map_header");
-    miniMapHeader.setPosition(
-        target .getSize()    .x - miniMapHeader.getLocalBounds().width + 5,
-        miniMap.getPosition().y - miniMapHeader.getLocalBounds().height
-    );
-
-    auto configInactive = _textureManager.sprite("config_inactive");
-    configInactive.setPosition(
-        target       .getSize()    .x - configInactive.getLocalBounds().width,
-        miniMapHeader.getPosition().y - configInactive.getLocalBounds().height
-    );
-
-    auto configActive = _textureManager.sprite("config_active");
-    configActive.setPosition(
-        configInactive.getPosition().x - configActive.getLocalBounds().width,
-        miniMapHeader .getPosition().y - configActive.getLocalBounds().height
-    );
-
-    auto configLabelBg = _textureManager.sprite("config_label");
-    configLabelBg.setPosition(
-        configActive .getPosition().x - configLabelBg.getLocalBounds().width,
-        miniMapHeader.getPosition().y - configLabelBg.getLocalBounds().height
-    );
-
-    auto inventoryRight = _textureManager.sprite("inventory_right");
-    inventoryRight.setPosition(
-        miniMap.getPosition().x - inventoryRight.getLocalBounds().width,
-        target .getSize()    .y - inventoryRight.getLocalBounds().height
-    );
-
-    auto inventoryCenter = _textureManager.sprite("inventory_center");
-    inventoryCenter.setPosition(
-        inventoryRight.getPosition().x - inventoryCenter.getLocalBounds().width,
-        inventoryRight.getPosition().y
-    );
-
-    auto inventoryLeft = _textureManager.sprite("inventory_left");
-    inventoryLeft.setPosition(
-        inventoryCenter.getPosition().x - inventoryLeft.getLocalBounds().width,
-        inventoryCenter.getPosition().y
-    );
-
-    auto inventoryTriangle = _textureManager.sprite("inventory_triangle");
-    inventoryTriangle.setPosition(
-        inventoryRight.getPosition().x - inventoryTriangle.getLocalBounds().width,
-        inventoryRight.getPosition().y - inventoryTriangle.getLocalBounds().height
-    );
-
-    auto inventoryContentBg = _textureManager.sprite("inventory_content_bg");
-    inventoryContentBg.setPosition(370, 579);
-
-    auto ammoAmountBg    = _textureManager.sprite("ammo_rocket_amount_bg");
-    auto rocketsAmountBg = _textureManager.sprite("ammo_rocket_amount_bg");
-    auto hpAmountBg      = _textureManager.sprite("hp_amount_bg");
-    auto shieldAmountBg  = _textureManager.sprite("shield_amount_bg");
-
-    hpAmountBg    .setPosition(514, 57);
-    shieldAmountBg.setPosition(514, 42);
-    ammoAmountBg  .setPosition(686, 42);
-    rocketsAmountBg.setPosition(686, 57);
-
-    for (auto && s : { &hpAmountBg, &shieldAmountBg, &ammoAmountBg, &rocketsAmountBg })
-        s->setColor(sf::Color(255, 255, 255, 120));
-
-    // TEXT
-
-    constexpr auto startY  = 8;
-    constexpr auto spacing = 10;
+    if (auto const state = _client ? _client->poll() : std::nullopt)
+        _world.apply(state->player, state->ship);
+    _world.update(elapsed.asSeconds());
 
-    sf::Font font;
-    Core::bAssert(font.loadFromFile("assets/font/orbitron-bold.ttf"), "Failed to load font");
+    _miniMap.update(elapsed, _world.entities(), _world.playerShip());
 
-    auto miniMapHeaderLabel = makeText(font, "MAP\t\t\t/POS");
-    centerVertically(miniMapHeaderLabel, miniMapHeader, miniMapHeader.getPosition().x + 6);
-
-    auto miniMapPosition = makeText(font, "\t\t{}/{}", _miniMapPos.x, _miniMapPos.y);
-    centerVertically(miniMapPosition, miniMapHeader,
-         miniMapHeaderLabel.getPosition().x + miniMapHeaderLabel.getLocalBounds().width);
-
-    auto configLabel = makeText(font, "CONFIGURATION");
-    centerIn(configLabel, configLabelBg);
-
-    auto config1 = makeText(font, "1");
-    auto config2 = makeText(font, "2");
-
-    centerIn(config1, configActive, 0, 1);
-    centerIn(config2, configInactive);
-
-    auto xpLabel      = makeText(font, "EXPERIENCE");
-    auto levelLabel   = makeText(font, "LEVEL");
-    auto honorLabel   = makeText(font, "HONOR");
-    auto jackpotLabel = makeText(font, "JACKPOT");
-
-    setTextPosition(xpLabel,      248, startY);
-    setTextPosition(levelLabel,   248, xpLabel   .getPosition().y + Constants::fontSize + spacing);
-    setTextPosition(honorLabel,   248, levelLabel.getPosition().y + Constants::fontSize + spacing);
-    setTextPosition(jackpotLabel, 248, honorLabel.getPosition().y + Constants::fontSize + spacing);
+    // Hot-reloaded font or texture: sprites and texts are made again from it
+    if (_fontManager.version() != _builtFonts || _textureManager.version() != _builtTextures)
+        buildHud();
+    _hud.refresh();
+}
 
-    auto xpValue      = makeText(font, "{:L}", _player.xp);
-    auto levelValue   = makeText(font, "{:L}", _player.level);
-    auto honorValue   = makeText(font, "{:L}", _player.honor);
-    auto jackpotValue = makeText(font, "{:L}", _player.jackpot);
+void SpaceMapScreen::publish()
+{
+    // Reloaded without a tick since: the previous font is released after this frame
+    if (_fontManager.version() != _builtFonts)
+    {
+        buildHud();
+        _hud.refresh();
+    }
 
-    xpValue     .setOrigin(std::ceilf(xpValue     .getLocalBounds().width), 0.f);
-    levelValue  .setOrigin(std::ceilf(levelValue  .getLocalBounds().width), 0.f);
-    honorValue  .setOrigin(std::ceilf(honorValue  .getLocalBounds().width), 0.f);
-    jackpotValue.setOrigin(std::ceilf(jackpotValue.getLocalBounds().width), 0.f);
+    _hud.publish();
+    _miniMap.publish();
+    _publishedHud     = _hud.version();
+    _publishedMiniMap = _miniMap.version();
+}
 
-    setTextPosition(xpValue,      415,                     xpLabel     .getGlobalBounds().top);
-    setTextPosition(levelValue,   xpValue.getPosition().x, levelLabel  .getGlobalBounds().top);
-    setTextPosition(honorValue,   xpValue.getPosition().x, honorLabel  .getGlobalBounds().top);
-    setTextPosition(jackpotValue, xpValue.getPosition().x, jackpotLabel.getGlobalBounds().top);
+auto SpaceMapScreen::dirty() const -> bool
+{
+    // Nothing moves on its own: only a changed widget or dot needs a redraw
+    return _hud.version() != _publishedHud || _miniMap.version() != _publishedMiniMap
+        || _fontManager.version() != _builtFonts;
+}
 
-    auto creditsLabel = makeText(font, "CREDITS");
-    auto uridiumLabel = makeText(font, "URIDIUM");
-    auto cargoLabel   = makeText(font, "CARGO BAY");
+void SpaceMapScreen::draw(sf::RenderTarget & target, sf::RenderStates states) const
+{
+    PROFILE_ZONE("SpaceMap draw");
+    target.draw(_hud, states);
+    target.draw(_miniMap, states);
+}
 
-    auto creditsValue = makeText(font, "{:L}", _player.credits);
-    auto uridiumValue = makeText(font, "{:L}", _player.uridium);
-    auto cargoValue   = makeText(font, "{:L}", _ship.curCargo);
+void SpaceMapScreen::buildHud()
+{
+    auto const & font = _fontManager.font("orbitron");
+    _builtFonts    = _fontManager.version();
+    _builtTextures = _textureManager.version();
+
+    // Entering can afford to throw: a missing texture is a broken install
+    auto const sprite = [this](Engine::TextureId id) { return _textureManager.sprite(id).value(); };
+
+    _layout.detach();
+    _hud.clear();
+
+    // Widgets are drawn in insertion order, and placed by the layout node named after them
+    auto const addSprite = [&](std::string_view node, Engine::TextureId id) -> sf::Sprite & {
+        auto & widget = _hud.add(sprite(id));
+        static_cast<void>(_layout.attach(node, widget));
+        return widget;
+    };
+    auto const addText = [&](std::string_view node, std::string const & str) -> sf::Text & {
+        auto & widget = _hud.add(makeText(font, str));
+        static_cast<void>(_layout.attach(node, widget));
+        return widget;
+    };
+
+    addSprite("header", _textures.header);
+
+    auto & hpAmountBg      = addSprite("hpAmountBg",      _textures.hpAmountBg);
+    auto & shieldAmountBg  = addSprite("shieldAmountBg",  _textures.shieldAmountBg);
+    auto & ammoAmountBg    = addSprite("ammoAmountBg",    _textures.ammoRocketAmountBg);
+    auto & rocketsAmountBg = addSprite("rocketsAmountBg", _textures.ammoRocketAmountBg);
 
-    setTextPosition(creditsLabel, 510,                                         startY + 2);
-    setTextPosition(uridiumLabel, 580,                                         startY + 2);
-    setTextPosition(cargoLabel,   670 - cargoLabel.getLocalBounds().width / 2, startY + 2);
+    for (auto && s : { &hpAmountBg, &shieldAmountBg, &ammoAmountBg, &rocketsAmountBg })
+        s->setColor(sf::Color(255, 255, 255, 120));
 
-    setTextPosition(creditsValue, creditsLabel.getPosition().x,
-                                  creditsLabel.getPosition().y + Constants::fontSize + spacing - 2);
-    setTextPosition(uridiumValue, uridiumLabel.getPosition().x,
-                                  uridiumLabel.getPosition().y + Constants::fontSize + spacing - 2);
-    setTextPosition(cargoValue,   cargoLabel  .getPosition().x,
-                                  cargoLabel  .getPosition().y + Constants::fontSize + spacing - 2);
+    // Drawn by _miniMap: its node is only sized
+    auto       miniMap     = sprite(_textures.miniMap);
+    auto const miniMapNode = _layout.node("miniMap");
+    _layout.resize(miniMapNode, { miniMap.getLocalBounds().width,
+                                  miniMap.getLocalBounds().height });
+
+    addSprite("miniMapHeader",      _textures.miniMapHeader);
+    addSprite("configLabelBg",      _textures.configLabel);
+    addSprite("configActive",       _textures.configActive);
+    addSprite("configInactive",     _textures.configInactive);
+    addSprite("inventoryRight",     _textures.inventoryRight);
+    addSprite("inventoryCenter",    _textures.inventoryCenter);
+    addSprite("inventoryLeft",      _textures.inventoryLeft);
+    addSprite("inventoryTriangle",  _textures.inventoryTriangle);
+    addSprite("inventoryContentBg", _textures.inventoryContentBg);
 
-    for (sf::Text * t : { &creditsLabel, &creditsValue, &uridiumLabel,
-                          &uridiumValue, &cargoLabel,   &cargoValue })
-    {
-        t->setOrigin(std::ceilf(t->getLocalBounds().width  / 2),
-                     std::ceilf(t->getLocalBounds().height / 2));
-    }
+    // TEXT
 
-    auto shieldLabel  = makeText(font, "SHIELD");
-    auto hpLabel      = makeText(font, "HIT POINTS");
-    auto ammoLabel    = makeText(font, "AMMO");
-    auto rocketsLabel = makeText(font, "ROCKETS");
-
-    hpLabel     .setOrigin(std::ceilf(hpLabel     .getLocalBounds().width), 0.f);
-    shieldLabel .setOrigin(std::ceilf(shieldLabel .getLocalBounds().width), 0.f);
-    ammoLabel   .setOrigin(std::ceilf(ammoLabel   .getLocalBounds().width), 0.f);
-    rocketsLabel.setOrigin(std::ceilf(rocketsLabel.getLocalBounds().width), 0.f);
-
-    shieldLabel .setPosition(shieldAmountBg .getPosition().x - 5,
-                             shieldAmountBg .getPosition().y - 2);
-    hpLabel     .setPosition(hpAmountBg     .getPosition().x - 5,
-                             hpAmountBg     .getPosition().y - 1);
-    ammoLabel   .setPosition(ammoAmountBg   .getPosition().x - 5,
-                             ammoAmountBg   .getPosition().y - 1);
-    rocketsLabel.setPosition(rocketsAmountBg.getPosition().x - 5,
-                             rocketsAmountBg.getPosition().y - 1);
-
-    auto shieldValue  = makeText(font, "{:L} / {:L}", _ship.curShield,  _ship.maxShield);
-    auto hpValue      = makeText(font, "{:L} / {:L}", _ship.curHp,      _ship.maxHp);
-    auto ammoValue    = makeText(font, "{:L} / {:L}", _ship.curAmmo,    _ship.maxAmmo);
-    auto rocketsValue = makeText(font, "{:L} / {:L}", _ship.curRockets, _ship.maxRockets);
-
-    setOutline(shieldValue,  sf::Color::Black);
-    setOutline(hpValue,      sf::Color::Black);
-    setOutline(ammoValue,    sf::Color::Black);
-    setOutline(rocketsValue, sf::Color::Black);
-
-    centerIn(shieldValue,  shieldAmountBg);
-    centerIn(hpValue,      hpAmountBg);
-    centerIn(ammoValue,    ammoAmountBg);
-    centerIn(rocketsValue, rocketsAmountBg);
-
-    target.draw(header);
-    target.draw(hpAmountBg);
-    target.draw(shieldAmountBg);
-    target.draw(ammoAmountBg);
-    target.draw(rocketsAmountBg);
-    target.draw(miniMap);
-    target.draw(miniMapHeader);
-    target.draw(configLabelBg);
-    target.draw(configActive);
-    target.draw(configInactive);
-    target.draw(inventoryRight);
-    target.draw(inventoryCenter);
-    target.draw(inventoryLeft);
-    target.draw(inventoryTriangle);
-    target.draw(inventoryContentBg);
-    // Draw text on top
-    target.draw(miniMapHeaderLabel);
-    target.draw(miniMapPosition);
-    target.draw(configLabel);
-    target.draw(config1);
-    target.draw(config2);
-    target.draw(xpLabel);
-    target.draw(xpValue);
-    target.draw(levelLabel);
-    target.draw(levelValue);
-    target.draw(honorLabel);
-    target.draw(honorValue);
-    target.draw(jackpotLabel);
-    target.draw(jackpotValue);
-    target.draw(creditsLabel);
-    target.draw(creditsValue);
-    target.draw(uridiumLabel);
-    target.draw(uridiumValue);
-    target.draw(cargoLabel);
-    target.draw(cargoValue);
-    target.draw(shieldLabel);
-    target.draw(shieldValue);
-    target.draw(hpLabel);
-    target.draw(hpValue);
-    target.draw(ammoLabel);
-    target.draw(ammoValue);
-    target.draw(rocketsLabel);
-    target.draw(rocketsValue);
+    addText("miniMapHeaderLabel", "MAP\t\t\t/POS");
+    auto & miniMapPosition = addText("miniMapPosition", "");
+
+    addText("configLabel", "CONFIGURATION");
+    addText("config1", "1");
+    addText("config2", "2");
+
+    addText("xpLabel", "EXPERIENCE");
+    auto & xpValue = addText("xpValue", "");
+
+    addText("levelLabel", "LEVEL");
+    auto & levelValue = addText("levelValue", "");
+
+    addText("honorLabel", "HONOR");
+    auto & honorValue = addText("honorValue", "");
+
+    addText("jackpotLabel", "JACKPOT");
+    auto & jackpotValue = addText("jackpotValue", "");
+
+    addText("creditsLabel", "CREDITS");
+    auto & creditsValue = addText("creditsValue", "");
+
+    addText("uridiumLabel", "URIDIUM");
+    auto & uridiumValue = addText("uridiumValue", "");
+
+    addText("cargoLabel", "CARGO BAY");
+    auto & cargoValue = addText("cargoValue", "");
+
+    addText("shieldLabel", "SHIELD");
+    auto & shieldValue = addText("shieldValue", "");
+
+    addText("hpLabel", "HIT POINTS");
+    auto & hpValue = addText("hpValue", "");
+
+    addText("ammoLabel", "AMMO");
+    auto & ammoValue = addText("ammoValue", "");
+
+    addText("rocketsLabel", "ROCKETS");
+    auto & rocketsValue = addText("rocketsValue", "");
+
+    for (sf::Text * t : { &shieldValue, &hpValue, &ammoValue, &rocketsValue })
+        setOutline(*t, sf::Color::Black);
+
+    _layout.solve();
+    markPlacedTexts();
+
+    auto const miniMapRect = _layout.rect(miniMapNode);
+    miniMap.setPosition(miniMapRect.left, miniMapRect.top);
+    _miniMap.setBackground(miniMap);
+
+    // A value that changes size only moves what's anchored to it: only those texts are rebuilt
+    auto const fit = [this](std::string_view node) {
+        _layout.fit(_layout.node(node));
+        markPlacedTexts();
+    };
+
+    _hud.bind([&, fit] {
+        setString(miniMapPosition, "\t\t{}/{}", _miniMap.position().x, _miniMap.position().y);
+        fit("miniMapPosition");
+    }, _miniMap.position());
+
+    _hud.bind([&, fit] {
+        setString(xpValue, "{}", grouped(_player.xp));
+        fit("xpValue");
+    }, _player.xp);
+    _hud.bind([&, fit] {
+        setString(levelValue, "{}", grouped(_player.level));
+        fit("levelValue");
+    }, _player.level);
+    _hud.bind([&, fit] {
+        setString(honorValue, "{}", grouped(_player.honor));
+        fit("honorValue");
+    }, _player.honor);
+    _hud.bind([&, fit] {
+        setString(jackpotValue, "{}", grouped(_player.jackpot));
+        fit("jackpotValue");
+    }, _player.jackpot);
+
+    _hud.bind([&, fit] {
+        setString(creditsValue, "{}", grouped(_player.credits));
+        fit("creditsValue");
+    }, _player.credits);
+    _hud.bind([&, fit] {
+        setString(uridiumValue, "{}", grouped(_player.uridium));
+        fit("uridiumValue");
+    }, _player.uridium);
+    _hud.bind([&, fit] {
+        setString(cargoValue, "{}", grouped(_ship.curCargo));
+        fit("cargoValue");
+    }, _ship.curCargo);
+
+    _hud.bind([&, fit] {
+        setString(shieldValue, "{} / {}", grouped(_ship.curShield), grouped(_ship.maxShield));
+        fit("shieldValue");
+    }, _ship.curShield, _ship.maxShield);
+    _hud.bind([&, fit] {
+        setString(hpValue, "{} / {}", grouped(_ship.curHp), grouped(_ship.maxHp));
+        fit("hpValue");
+    }, _ship.curHp, _ship.maxHp);
+    _hud.bind([&, fit] {
+        setString(ammoValue, "{} / {}", grouped(_ship.curAmmo), grouped(_ship.maxAmmo));
+        fit("ammoValue");
+    }, _ship.curAmmo, _ship.maxAmmo);
+    _hud.bind([&, fit] {
+        setString(rocketsValue, "{} / {}",
+                  grouped(_ship.curRockets), grouped(_ship.maxRockets));
+        fit("rocketsValue");
+    }, _ship.curRockets, _ship.maxRockets);
 }
-catch (...)
+
+void SpaceMapScreen::markPlacedTexts()
 {
-    THROW_NESTED("Failed to draw frame");
+    _layout.takePlacedTexts([this](sf::Text const & text) { _hud.changed(text); });
 }
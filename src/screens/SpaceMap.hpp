@@ -5,28 +5,60 @@
 #pragma once
 
 // Project includes
+#include "MiniMap.hpp"
+#include "../engine/Hud.hpp"
+#include "../engine/Layout.hpp"
 #include "../engine/Screen.hpp"
 #include "../engine/TextureManager.hpp"
-#include "../game/PlayerStats.hpp"
-#include "../game/ShipStats.hpp"
+#include "../game/World.hpp"
 
+namespace Engine  { class FontManager;    }
+namespace Net     { class Client;         }
 namespace Screens { class SpaceMapScreen; }
 
 class Screens::SpaceMapScreen final : public Engine::Screen
 {
 private:
-    Engine::TextureManager _textureManager;
-    sf::Vector2u           _miniMapPos;
-    Game::PlayerStats      _player;
-    Game::ShipStats        _ship;
+    Engine::FontManager const & _fontManager;
+    Net::Client *               _client; ///< Stats stay at their defaults without a server
+    Engine::TextureManager      _textureManager;
+    Engine::Hud                 _hud;
+    Engine::Layout              _layout;
+    MiniMap                     _miniMap;
+    std::size_t                 _publishedHud     = 0; ///< Versions last published
+    std::size_t                 _publishedMiniMap = 0;
+    std::size_t                 _builtFonts       = 0; ///< Asset versions the HUD was built with
+    std::size_t                 _builtTextures    = 0;
+
+    struct Textures
+    {
+        Engine::TextureId header, ammoRocketAmountBg, hpAmountBg, shieldAmountBg;
+        Engine::TextureId miniMap, miniMapHeader;
+        Engine::TextureId configLabel, configActive, configInactive;
+        Engine::TextureId inventoryRight, inventoryCenter, inventoryLeft, inventoryTriangle;
+        Engine::TextureId inventoryContentBg;
+    } _textures{};
+
+    Game::World                 _world;
+    Game::PlayerStats const &   _player = _world.player();
+    Game::ShipStats   const &   _ship   = _world.ship();
 
 public:
-    SpaceMapScreen() noexcept;
+    explicit SpaceMapScreen(Engine::FontManager const & fontManager,
+                            Net::Client * client = nullptr);
 
 public:
-    void enter() override;
+    void load (Engine::AssetLoader & loader) override;
+    void enter()                             override;
+    void reload(std::filesystem::path const & path, Engine::AssetLoader & loader) override;
 
 public:
-    void onEvent(sf::Event const & event) override;
-    void draw(sf::RenderTarget & target, sf::RenderStates) const override;
+    void update (sf::Time  const &)       override;
+    void publish()                        override;
+    [[nodiscard]] auto dirty() const -> bool override;
+    void draw(sf::RenderTarget & target, sf::RenderStates states) const override;
+
+private:
+    void buildHud();
+    void markPlacedTexts();
 };
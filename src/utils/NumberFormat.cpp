@@ -0,0 +1,57 @@
+/// @file   NumberFormat.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#include "NumberFormat.hpp"
+
+// C++ includes
+#include <climits>
+#include <string>
+
+namespace
+{
+    // Written once at startup, only read afterwards
+    char        separator = ',';
+    std::string grouping  = "\3"; ///< std::numpunct::grouping(): group sizes, rightmost first
+} // !namespace
+
+void Utils::setNumberLocale(std::locale const & locale)
+{
+    auto const & punct = std::use_facet<std::numpunct<char>>(locale);
+    grouping = punct.grouping();
+
+    // A multi-byte separator (U+202F in fr_FR.UTF-8...) only has its first byte here, which
+    // isn't a character: a space stands in. Numbers stay within the glyphs fonts pre-warm.
+    auto const sep = static_cast<unsigned char>(punct.thousands_sep());
+    separator = sep >= 0x20 && sep < 0x7F ? static_cast<char>(sep) : ' ';
+}
+
+auto Utils::formatGrouped(std::uint64_t value, bool negative, char * out) -> char *
+{
+    // Digits are produced right to left into a scratch buffer, then copied in order
+    char         buffer[40];
+    char * const end = buffer + sizeof(buffer);
+    char *       it  = end;
+
+    auto group     = grouping.begin();
+    int  groupSize = group != grouping.end() ? *group : 0;
+    int  inGroup   = 0;
+    do
+    {
+        if (groupSize > 0 && groupSize != CHAR_MAX && inGroup == groupSize)
+        {
+            *--it   = separator;
+            inGroup = 0;
+            if (group + 1 != grouping.end()) // The last size repeats
+                groupSize = *++group;
+        }
+
+        *--it = static_cast<char>('0' + value % 10);
+        value /= 10;
+        ++inGroup;
+    } while (value != 0);
+
+    if (negative)
+        *--it = '-';
+    return std::copy(it, end, out);
+}
@@ -0,0 +1,55 @@
+/// @file   NumberFormat.hpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+
+#pragma once
+
+// Third-party includes
+#include <fmt/format.h>
+
+// C++ includes
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <locale>
+
+namespace Utils
+{
+    /// Looks @p locale's digit grouping up once. Call at startup, before other threads format.
+    void setNumberLocale(std::locale const & locale);
+
+    /// Writes @p value grouped like {:L} would with the locale given to setNumberLocale(), without
+    /// going through std::locale. @p out needs room for 40 characters; returns the end.
+    auto formatGrouped(std::uint64_t value, bool negative, char * out) -> char *;
+
+    /// Integer formatted with digit grouping, e.g. fmt::format("{}", grouped(1234)) -> "1,234"
+    template<std::integral T>
+    struct Grouped
+    {
+        T value;
+    };
+
+    template<std::integral T>
+    [[nodiscard]] constexpr auto grouped(T value) noexcept -> Grouped<T> { return { value }; }
+} // !namespace Utils
+
+template<std::integral T>
+struct fmt::formatter<Utils::Grouped<T>>
+{
+    constexpr auto parse(format_parse_context & ctx) { return ctx.begin(); }
+
+    template<typename Context>
+    auto format(Utils::Grouped<T> const & number, Context & ctx) const
+    {
+        auto negative = false;
+        if constexpr (std::signed_integral<T>)
+            negative = number.value < 0;
+
+        auto const magnitude = negative ? 0 - static_cast<std::uint64_t>(number.value)
+                                        : static_cast<std::uint64_t>(number.value);
+
+        char buffer[40];
+        auto const end = Utils::formatGrouped(magnitude, negative, buffer);
+        return std::copy(buffer, end, ctx.out());
+    }
+};
@@ -11,6 +11,9 @@
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Text.hpp>
 
+// C++ includes
+#include <algorithm>
+
 auto Utils::makeText(sf::Font const & font, std::string const & str) -> sf::Text
 {
     return makeText(font, Constants::fontSize, str);
@@ -18,10 +21,25 @@ auto Utils::makeText(sf::Font const & font, std::string const & str) -> sf::Text
 
 auto Utils::makeText(sf::Font const & font, unsigned fontSize, std::string const & str) -> sf::Text
 {
-    sf::Text text(str, font, fontSize);
+    // Decoded as UTF-8: sf::String's std::string constructor goes through std::locale
+    sf::Text text(sf::String::fromUtf8(str.begin(), str.end()), font, fontSize);
     return text;
 }
 
+void Utils::setString(sf::Text & text, std::string_view str)
+{
+    // Compared in place: building an sf::String to compare would allocate. Non-ASCII strings
+    // never compare equal, they're just set again.
+    auto const & current = text.getString();
+    if (std::equal(str.begin(), str.end(), current.begin(), current.end(),
+                   [](char c, sf::Uint32 u) { return static_cast<unsigned char>(c) == u; }))
+    {
+        return;
+    }
+
+    text.setString(sf::String::fromUtf8(str.begin(), str.end()));
+}
+
 void Utils::setTextPosition(sf::Text & text, float x, float y)
 {
     text.setPosition(std::ceilf(x - text.getLocalBounds().left),
@@ -34,6 +52,11 @@ void Utils::setOutline(sf::Text & text, sf::Color const & color, float thickness
     text.setOutlineColor(color);
 }
 
+void Utils::setOutline(sf::Text & text, sf::Color const & color)
+{
+    setOutline(text, color, Constants::textOutline);
+}
+
 void Utils::centerIn(sf::Text & dst, sf::Sprite const & src, float x, float y)
 {
     float const width  = src.getGlobalBounds().width  / 2 - dst.getGlobalBounds().width  / 2;
@@ -4,9 +4,17 @@
 
 #pragma once
 
+// Project includes
+#include "NumberFormat.hpp"
+
 // Third-party includes
 #include <fmt/format.h>
 
+// C++ includes
+#include <iterator>
+#include <string>
+#include <string_view>
+
 namespace sf
 {
     class Color;
@@ -31,7 +39,23 @@ namespace Utils
         return makeText(font, fontSize, fmt::format(std::move(str), std::forward<Args>(args)...));
     }
 
-    void setOutline(sf::Text & text, sf::Color const & color, float thickness = 1.f);
+    /// Leaves @p text, and the glyph geometry it built, untouched when it already shows @p str
+    void setString(sf::Text & text, std::string_view str);
+    inline void setString(sf::Text & text, std::string const & str) {
+        setString(text, std::string_view(str));
+    }
+
+    /// Formats into a stack buffer: no allocation unless the text changes.
+    /// Use Utils::grouped() rather than {:L} for digit grouping.
+    template<typename... Args>
+    inline void setString(sf::Text & text, fmt::format_string<Args...> str, Args &&... args) {
+        fmt::memory_buffer buffer;
+        fmt::format_to(std::back_inserter(buffer), std::move(str), std::forward<Args>(args)...);
+        setString(text, std::string_view(buffer.data(), buffer.size()));
+    }
+
+    void setOutline(sf::Text & text, sf::Color const & color, float thickness);
+    void setOutline(sf::Text & text, sf::Color const & color);
 
     void setTextPosition (sf::Text & text, float x, float y);
     void centerIn        (sf::Text & dst, sf::Sprite const & src, float x = 0, float y = 0);
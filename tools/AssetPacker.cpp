@@ -0,0 +1,155 @@
+/// @file   AssetPacker.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Writes the asset archive mounted by the game at startup.
+/// Usage: DarkOrbitPack <output> <files or directories...>
+/// Entries are keyed by their path as given (e.g. "assets/favicon.png"), which must match the paths
+/// the game loads. Images are stored decoded to RGBA, everything else as is.
+
+// Project includes
+#include "../src/core/Exception.hpp"
+#include "../src/engine/AssetArchive.hpp"
+
+// Third-party includes
+#include <SFML/Graphics/Image.hpp>
+#include <spdlog/spdlog.h>
+
+// C++ includes
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <set>
+
+namespace Archive = Engine::Archive;
+
+namespace
+{
+    struct Asset
+    {
+        std::string       name;
+        Archive::Type     type   = Archive::Type::Raw;
+        unsigned          width  = 0;
+        unsigned          height = 0;
+        std::vector<char> data;
+    };
+
+    auto isImage(std::filesystem::path const & path) -> bool
+    {
+        static std::set<std::string> const extensions = { ".png", ".jpg", ".jpeg", ".bmp", ".tga" };
+        return extensions.contains(path.extension().string());
+    }
+
+    auto readAsset(std::filesystem::path const & path) -> Asset
+    {
+        Asset asset;
+        asset.name = path.generic_string();
+
+        if (isImage(path))
+        {
+            sf::Image image;
+            Core::bAssert(image.loadFromFile(path.string()), "Failed to decode {}", asset.name);
+
+            auto const * const pixels = reinterpret_cast<char const *>(image.getPixelsPtr());
+            asset.type   = Archive::Type::Image;
+            asset.width  = image.getSize().x;
+            asset.height = image.getSize().y;
+            asset.data.assign(pixels, pixels + std::size_t(asset.width) * asset.height * 4);
+        }
+        else
+        {
+            std::ifstream file(path, std::ios::binary);
+            Core::bAssert(file.is_open(), "Failed to open {}", asset.name);
+            asset.data.assign(std::istreambuf_iterator<char>(file), {});
+        }
+        return asset;
+    }
+
+    auto align(std::uint64_t offset) -> std::uint64_t
+    {
+        constexpr auto a = Archive::payloadAlignment;
+        return (offset + a - 1) / a * a;
+    }
+
+    void write(std::filesystem::path const & output, std::vector<Asset> const & assets)
+    {
+        std::string names;
+        for (auto && asset : assets)
+            names += asset.name;
+
+        Archive::Header header{};
+        std::memcpy(header.magic, Archive::magic, sizeof(header.magic));
+        header.version    = Archive::version;
+        header.entryCount = static_cast<std::uint32_t>(assets.size());
+        header.namesSize  = static_cast<std::uint32_t>(names.size());
+
+        std::vector<Archive::EntryRecord> records;
+        std::uint64_t offset = sizeof(header) + assets.size() * sizeof(Archive::EntryRecord)
+                             + names.size();
+        std::uint32_t nameOffset = 0;
+
+        for (auto && asset : assets)
+        {
+            offset = align(offset);
+            records.push_back({ offset, asset.data.size(), nameOffset,
+                                static_cast<std::uint32_t>(asset.name.size()),
+                                asset.type, asset.width, asset.height, 0 });
+            offset     += asset.data.size();
+            nameOffset += static_cast<std::uint32_t>(asset.name.size());
+        }
+
+        std::filesystem::create_directories(std::filesystem::absolute(output).parent_path());
+        std::ofstream file(output, std::ios::binary);
+        Core::bAssert(file.is_open(), "Failed to open {}", output.string());
+
+        file.write(reinterpret_cast<char const *>(&header), sizeof(header));
+        file.write(reinterpret_cast<char const *>(records.data()),
+                   static_cast<std::streamsize>(records.size() * sizeof(Archive::EntryRecord)));
+        file.write(names.data(), static_cast<std::streamsize>(names.size()));
+
+        for (std::size_t i = 0; i < assets.size(); ++i)
+        {
+            auto const padding = static_cast<std::size_t>(records[i].offset)
+                               - static_cast<std::size_t>(file.tellp());
+            std::fill_n(std::ostreambuf_iterator<char>(file), padding, '\0');
+            file.write(assets[i].data.data(), static_cast<std::streamsize>(assets[i].data.size()));
+        }
+
+        Core::bAssert(file.good(), "Failed to write {}", output.string());
+    }
+} // !namespace
+
+int main(int argc, char * argv[]) try
+{
+    Core::bAssert(argc > 2, "Usage: {} <output> <files or directories...>", argv[0]);
+
+    std::set<std::filesystem::path> paths; // Sorted: reproducible archives
+    for (int i = 2; i < argc; ++i)
+    {
+        std::filesystem::path const path = argv[i];
+        if (std::filesystem::is_directory(path))
+        {
+            for (auto && entry : std::filesystem::recursive_directory_iterator(path))
+                if (entry.is_regular_file())
+                    paths.insert(entry.path());
+        }
+        else
+        {
+            Core::bAssert(std::filesystem::is_regular_file(path), "No such file: {}", argv[i]);
+            paths.insert(path);
+        }
+    }
+
+    std::vector<Asset> assets;
+    for (auto && path : paths)
+        assets.push_back(readAsset(path));
+
+    write(argv[1], assets);
+    spdlog::info("Packed {} assets into {}", assets.size(), argv[1]);
+}
+catch (std::exception const & e)
+{
+    spdlog::critical(Core::formatExceptionStack(e));
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,44 @@
+/// @file   AtlasPacker.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Build-time texture atlas packer.
+/// Usage: DarkOrbitAtlas <output index> <page size> <images...>
+/// Images are keyed by the path they are given with, which must match the paths the game loads.
+
+// Project includes
+#include "../src/core/Exception.hpp"
+#include "../src/engine/TextureAtlas.hpp"
+
+// Third-party includes
+#include <spdlog/spdlog.h>
+
+// C++ includes
+#include <string>
+
+int main(int argc, char * argv[]) try
+{
+    Core::bAssert(argc > 3, "Usage: {} <output index> <page size> <images...>", argv[0]);
+
+    std::filesystem::path const index = argv[1];
+    auto const pageSize = static_cast<unsigned>(std::stoul(argv[2]));
+
+    std::vector<Engine::NamedImage> images;
+    for (int i = 3; i < argc; ++i)
+    {
+        auto const path = std::filesystem::path(argv[i]).generic_string();
+        auto & [name, image] = images.emplace_back(path, sf::Image());
+        Core::bAssert(image.loadFromFile(path), "Failed to load image {}", path);
+    }
+
+    auto const atlas = Engine::packAtlas(images, pageSize);
+    Engine::saveAtlas(atlas, index);
+
+    spdlog::info("Packed {} images into {} page(s) of {}px: {}",
+                 images.size(), atlas.pages.size(), pageSize, index.string());
+}
+catch (std::exception const & e)
+{
+    spdlog::critical(Core::formatExceptionStack(e));
+    return EXIT_FAILURE;
+}
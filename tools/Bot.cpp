@@ -0,0 +1,254 @@
+/// @file   Bot.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Headless load-test client: runs many simulated players in one process, each with its own
+/// connection and Game::World ticked like the game's, on a few worker threads. No SFML graphics.
+/// Usage: DarkOrbitBot [--bots N] [--threads N] [--host H] [--port N] [--seconds S]
+///                     [--budget KB] [--log-level L]
+/// Reports throughput every second, then each bot's memory, and fails if it exceeds the budget.
+
+// Project includes
+#include "../src/core/Constants.hpp"
+#include "../src/core/Exception.hpp"
+#include "../src/core/Logging.hpp"
+#include "../src/core/Profiler.hpp"
+#include "../src/game/World.hpp"
+#include "../src/net/Connection.hpp"
+
+// Third-party includes
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /// Connection attempts don't block: one the server doesn't answer is given up after this
+    auto const connectTimeout = sf::milliseconds(500);
+    auto const retryDelay     = std::chrono::seconds(1); ///< Between attempt starts
+
+    struct Options
+    {
+        std::string   host    = "127.0.0.1";
+        sf::IpAddress address;               ///< host, resolved once for all bots
+        std::uint16_t port    = Net::defaultPort;
+        std::size_t   bots    = 1'000;
+        std::size_t   threads = std::max(std::thread::hardware_concurrency(), 1u);
+        float         seconds = 10.f;
+        std::size_t   budget  = 0; ///< Bytes per bot, 0 for none
+    };
+
+    struct Bot
+    {
+        /// Bots never query the grid: a single cell keeps it to a few bytes
+        Game::World       world { std::max(Constants::mapWidth, Constants::mapHeight) };
+        Net::Connection   connection;
+        Clock::time_point retryAt;
+
+        [[nodiscard]] auto memoryUsage() const -> std::size_t
+        {
+            return sizeof(Bot) + world.memoryUsage() + connection.memoryUsage();
+        }
+    };
+
+    /// What a worker publishes after each tick, for the main thread's reports
+    struct Stats
+    {
+        std::atomic<std::size_t>   connected     { 0 };
+        std::atomic<std::uint64_t> receivedBytes { 0 };
+        std::atomic<std::uint64_t> snapshots     { 0 };
+        std::atomic<std::uint64_t> lateTicks     { 0 }; ///< Ticks that started after the next
+    };
+
+    auto parsePort(std::string const & value) -> std::uint16_t
+    {
+        auto const port = std::stoi(value);
+        Core::bAssert(port > 0 && port <= 65'535, "Invalid port {}", value);
+        return static_cast<std::uint16_t>(port);
+    }
+
+    auto parseOptions(std::span<char *> args) -> Options
+    {
+        Options options;
+        for (std::size_t i = 0; i < args.size(); ++i)
+        {
+            std::string_view const arg   = args[i];
+            auto const             value = [&] {
+                Core::bAssert(i + 1 < args.size(), "Missing value for {}", arg);
+                return std::string(args[++i]);
+            };
+
+            /**/ if (arg == "--host")    options.host    = value();
+            else if (arg == "--port")    options.port    = parsePort(value());
+            else if (arg == "--bots")    options.bots    = std::stoul(value());
+            else if (arg == "--threads") options.threads = std::stoul(value());
+            else if (arg == "--seconds") options.seconds = std::stof(value());
+            else if (arg == "--log-level") spdlog::set_level(Core::parseLogLevel(value()));
+            else if (arg == "--budget")  options.budget  = std::stoul(value()) * 1024;
+            else
+                throw Core::Exception("Unknown option '{}'", arg);
+        }
+        Core::bAssert(options.bots > 0,    "Invalid bot count {}",    options.bots);
+        Core::bAssert(options.threads > 0, "Invalid thread count {}", options.threads);
+        options.threads = std::min(options.threads, options.bots);
+
+        options.address = sf::IpAddress(options.host);
+        Core::bAssert(options.address != sf::IpAddress::None, "Can't resolve {}", options.host);
+        return options;
+    }
+
+    /// One bot's tick, as the space map screen's update
+    void tick(Bot & bot, Options const & options, float dt, Clock::time_point now)
+    {
+        // A slow or unreachable server mustn't stall the worker's other bots: connecting only
+        // starts here, pump() completes it on later ticks
+        auto & connection = bot.connection;
+        if (!connection.connected() && !connection.connecting() && now >= bot.retryAt)
+        {
+            bot.retryAt = now + retryDelay;
+            static_cast<void>(connection.beginConnect(options.address, options.port,
+                                                      connectTimeout));
+        }
+
+        try
+        {
+            if (connection.pump())
+                bot.world.apply(connection.state().player, connection.state().ship);
+        }
+        catch (std::exception const & e)
+        {
+            spdlog::warn("[Bot] {}", Core::formatExceptionStack(e));
+            connection.disconnect();
+            bot.retryAt = now + retryDelay;
+        }
+
+        bot.world.update(dt);
+    }
+
+    /// Ticks @p bots at the game's tick rate until @p stop is requested
+    void work(std::stop_token const & stop, std::span<std::unique_ptr<Bot>> bots,
+              Options const & options, Stats & stats)
+    {
+        auto const dt     = 1.f / static_cast<float>(Constants::tickRate);
+        auto const period = std::chrono::duration_cast<Clock::duration>(
+                                std::chrono::duration<float>(dt));
+
+        auto next = Clock::now();
+        while (!stop.stop_requested())
+        {
+            auto const now = Clock::now();
+
+            std::size_t   connected = 0;
+            std::uint64_t bytes = 0, snapshots = 0;
+            for (auto & bot : bots)
+            {
+                tick(*bot, options, dt, now);
+                connected += bot->connection.connected();
+                bytes     += bot->connection.receivedBytes();
+                snapshots += bot->connection.snapshots();
+            }
+            stats.connected     = connected;
+            stats.receivedBytes = bytes;
+            stats.snapshots     = snapshots;
+
+            // A worker that falls behind catches up rather than drifting
+            next += period;
+            if (Clock::now() > next)
+            {
+                ++stats.lateTicks;
+                next = Clock::now();
+            }
+            else
+                std::this_thread::sleep_until(next);
+        }
+    }
+
+    /// Per-bot memory: average and max, in bytes. Workers must be stopped.
+    auto measure(std::vector<std::unique_ptr<Bot>> const & bots) -> std::pair<double, std::size_t>
+    {
+        std::size_t total = 0, max = 0;
+        for (auto const & bot : bots)
+        {
+            auto const bytes = bot->memoryUsage();
+            total += bytes;
+            max    = std::max(max, bytes);
+        }
+        return { static_cast<double>(total) / static_cast<double>(bots.size()), max };
+    }
+} // !namespace
+
+int main(int argc, char * argv[]) try
+{
+    Core::AsyncLogging const logging("DarkOrbitBot");
+    auto const options = parseOptions(std::span(argv, static_cast<std::size_t>(argc)).subspan(1));
+    spdlog::info("Running {} bot(s) on {} thread(s) against {}:{}", options.bots, options.threads,
+                 options.host, options.port);
+
+    std::vector<std::unique_ptr<Bot>> bots;
+    bots.reserve(options.bots);
+    for (std::size_t i = 0; i < options.bots; ++i)
+        bots.push_back(std::make_unique<Bot>());
+
+    // Each worker owns a contiguous slice of the bots
+    std::vector<Stats> stats(options.threads);
+    {
+        std::vector<std::jthread> workers;
+        for (std::size_t t = 0; t < options.threads; ++t)
+        {
+            auto const begin = options.bots *  t      / options.threads;
+            auto const end   = options.bots * (t + 1) / options.threads;
+            workers.emplace_back([&, t, begin, end](std::stop_token stop) {
+                Core::Profiler::nameThread(fmt::format("Bots {}", t));
+                work(stop, std::span(bots).subspan(begin, end - begin), options, stats[t]);
+            });
+        }
+
+        std::uint64_t lastBytes = 0, lastSnapshots = 0, lastLate = 0;
+        for (auto second = 1.f; second <= options.seconds; ++second)
+        {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+
+            std::size_t   connected = 0;
+            std::uint64_t bytes = 0, snapshots = 0, late = 0;
+            for (auto const & s : stats)
+            {
+                connected += s.connected;
+                bytes     += s.receivedBytes;
+                snapshots += s.snapshots;
+                late      += s.lateTicks;
+            }
+
+            spdlog::info("{}/{} connected | {} snapshots/s | {:.1f} KB/s | {} late tick(s)",
+                         connected, bots.size(), snapshots - lastSnapshots,
+                         static_cast<float>(bytes - lastBytes) / 1024.f, late - lastLate);
+            lastBytes     = bytes;
+            lastSnapshots = snapshots;
+            lastLate      = late;
+        }
+    } // Joins the workers
+
+    auto const [average, max] = measure(bots);
+    spdlog::info("Memory per bot: {:.0f} B average, {} B max", average, max);
+    Core::bAssert(options.budget == 0 || max <= options.budget,
+                  "A bot takes {} B, over the {} KB budget", max, options.budget / 1024);
+}
+catch (std::exception const & e)
+{
+    spdlog::critical(Core::formatExceptionStack(e));
+    return EXIT_FAILURE;
+}
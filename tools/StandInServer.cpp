@@ -0,0 +1,292 @@
+/// @file   StandInServer.cpp
+/// @author Pierre Caissial
+/// @date   Created on 17/10/2026
+///
+/// Loopback stand-in for the game server: feeds every client made-up stats through the real
+/// protocol, for integration and load tests.
+/// Usage: DarkOrbitServer [--port N] [--rate snapshots/s]
+///        DarkOrbitServer --load <clients> [--host H] [--port N] [--seconds S]
+/// The second form connects that many clients to a running server and reports their throughput.
+/// Both take --log-level <level>, see Core::parseLogLevel().
+
+// Project includes
+#include "../src/core/Exception.hpp"
+#include "../src/core/Logging.hpp"
+#include "../src/game/Formulas.hpp"
+#include "../src/net/Client.hpp"
+#include "../src/net/Protocol.hpp"
+
+// Third-party includes
+#include <SFML/Network/SocketSelector.hpp>
+#include <SFML/Network/TcpListener.hpp>
+#include <SFML/Network/TcpSocket.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+#include <spdlog/spdlog.h>
+
+// C++ includes
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    constexpr std::size_t receiveSize   = 1024;
+    constexpr std::size_t maxPendingOut = 1 << 16; // Beyond, the client is too slow: dropped
+
+    struct Options
+    {
+        std::string   host    = "127.0.0.1";
+        std::uint16_t port    = Net::defaultPort;
+        float         rate    = 10.f;
+        std::size_t   load    = 0; ///< Clients to simulate, 0 to serve
+        float         seconds = 10.f;
+    };
+
+    struct Session
+    {
+        sf::TcpSocket             socket;
+        Net::Framer               framer;
+        Net::State                state; ///< Made up
+        Net::State                sent;  ///< Baseline of the next snapshot
+        std::vector<std::uint8_t> out;
+        std::mt19937              random;
+        bool                      greeted = false;
+    };
+
+    auto parsePort(std::string const & value) -> std::uint16_t
+    {
+        auto const port = std::stoi(value);
+        Core::bAssert(port > 0 && port <= 65'535, "Invalid port {}", value);
+        return static_cast<std::uint16_t>(port);
+    }
+
+    auto parseOptions(std::span<char *> args) -> Options
+    {
+        Options options;
+        for (std::size_t i = 0; i < args.size(); ++i)
+        {
+            std::string_view const arg   = args[i];
+            auto const             value = [&] {
+                Core::bAssert(i + 1 < args.size(), "Missing value for {}", arg);
+                return std::string(args[++i]);
+            };
+
+            /**/ if (arg == "--host")    options.host    = value();
+            else if (arg == "--port")    options.port    = parsePort(value());
+            else if (arg == "--rate")    options.rate    = std::stof(value());
+            else if (arg == "--load")    options.load    = std::stoul(value());
+            else if (arg == "--seconds") options.seconds = std::stof(value());
+            else if (arg == "--log-level") spdlog::set_level(Core::parseLogLevel(value()));
+            else
+                throw Core::Exception("Unknown option '{}'", arg);
+        }
+        Core::bAssert(options.rate > 0.f, "Invalid rate {}", options.rate);
+        return options;
+    }
+
+    /// What a player's stats could look like from one snapshot to the next
+    void simulate(Net::State & state, std::mt19937 & random)
+    {
+        auto const chance = [&](unsigned percent) { return random() % 100 < percent; };
+        auto &     player = state.player;
+        auto &     ship   = state.ship;
+
+        if (chance(30))
+        {
+            player.xp      += random() % 1'000;
+            player.credits += random() % 500;
+            player.level    = Formulas::getLevelFromXp(player.xp);
+        }
+        if (chance(5))
+            player.honor += random() % 100;
+
+        if (chance(20))
+        {
+            auto const damage = std::min<std::uint32_t>(random() % 2'000, ship.curHp);
+            ship.curHp    -= damage;
+            ship.curShield = ship.curShield > damage ? ship.curShield - damage : 0;
+            ship.curAmmo   = ship.curAmmo > 10 ? ship.curAmmo - 10 : ship.maxAmmo;
+        }
+        else
+        {
+            ship.curShield = std::min(ship.curShield + 500, ship.maxShield);
+            ship.curHp     = std::min(ship.curHp + 100, ship.maxHp);
+        }
+    }
+
+    /// Sends what it can of @p session's output without blocking. False if the client is gone.
+    auto flush(Session & session) -> bool
+    {
+        if (session.out.empty())
+            return true;
+
+        std::size_t sent   = 0;
+        auto const  status = session.socket.send(session.out.data(), session.out.size(), sent);
+        if (status == sf::Socket::Disconnected || status == sf::Socket::Error)
+            return false;
+
+        auto const begin = session.out.begin();
+        session.out.erase(begin, begin + static_cast<std::ptrdiff_t>(sent));
+        return session.out.size() <= maxPendingOut;
+    }
+
+    /// Reads what @p session sent. False if the client is gone or misbehaves.
+    auto receive(Session & session, std::uint32_t tick) -> bool
+    {
+        std::size_t received = 0;
+        auto const  status   = session.socket.receive(session.framer.prepare(receiveSize),
+                                                      receiveSize, received);
+        if (status == sf::Socket::Disconnected || status == sf::Socket::Error)
+            return false;
+        session.framer.commit(received);
+
+        while (auto message = session.framer.next())
+        {
+            Net::Reader body(*message);
+            Core::bAssert(!session.greeted
+                       && static_cast<Net::MessageType>(body.byte()) == Net::MessageType::Hello,
+                          "Unexpected message");
+            Net::readHello(body);
+
+            session.greeted = true;
+            Net::writeSnapshot(session.out, session.state, {}, tick, true);
+            session.sent = session.state;
+        }
+        return flush(session);
+    }
+
+    void serve(Options const & options)
+    {
+        sf::TcpListener listener;
+        Core::bAssert(listener.listen(options.port) == sf::Socket::Done,
+                      "Failed to listen on port {}", options.port);
+        listener.setBlocking(false);
+        spdlog::info("Listening on port {}, {} snapshots/s", options.port, options.rate);
+
+        sf::SocketSelector selector;
+        selector.add(listener);
+
+        std::vector<std::unique_ptr<Session>> sessions;
+        std::uint32_t                         tick = 0;
+        std::uint64_t                         bytes = 0;
+        std::random_device                    seed;
+
+        auto const period = sf::seconds(1.f / options.rate);
+        sf::Clock  sinceTick, sinceReport;
+        while (true)
+        {
+            static_cast<void>(selector.wait(std::max(period - sinceTick.getElapsedTime(),
+                                                     sf::milliseconds(1))));
+
+            if (selector.isReady(listener))
+            {
+                for (auto session = std::make_unique<Session>();
+                     listener.accept(session->socket) == sf::Socket::Done;
+                     session = std::make_unique<Session>())
+                {
+                    session->socket.setBlocking(false);
+                    session->random.seed(seed());
+                    selector.add(session->socket);
+                    sessions.push_back(std::move(session));
+                }
+            }
+
+            auto const newTick = sinceTick.getElapsedTime() >= period;
+            if (newTick)
+            {
+                sinceTick.restart();
+                ++tick;
+            }
+
+            std::erase_if(sessions, [&](auto & session) {
+                auto alive = true;
+                try
+                {
+                    if (selector.isReady(session->socket))
+                        alive = receive(*session, tick);
+
+                    if (alive && newTick && session->greeted)
+                    {
+                        simulate(session->state, session->random);
+                        auto const size = session->out.size();
+                        Net::writeSnapshot(session->out, session->state, session->sent, tick,
+                                           false);
+                        bytes        += session->out.size() - size;
+                        session->sent = session->state;
+                        alive         = flush(*session);
+                    }
+                }
+                catch (std::exception const & e)
+                {
+                    spdlog::warn("Dropping client: {}", Core::formatExceptionStack(e));
+                    alive = false;
+                }
+
+                if (!alive)
+                    selector.remove(session->socket);
+                return !alive;
+            });
+
+            if (sinceReport.getElapsedTime() >= sf::seconds(5.f))
+            {
+                auto const seconds = sinceReport.restart().asSeconds();
+                spdlog::info("{} client(s) | {:.1f} KB/s of snapshots", sessions.size(),
+                             static_cast<float>(bytes) / 1024.f / seconds);
+                bytes = 0;
+            }
+        }
+    }
+
+    void load(Options const & options)
+    {
+        spdlog::info("Connecting {} client(s) to {}:{}", options.load, options.host,
+                     options.port);
+
+        std::vector<std::unique_ptr<Net::Client>> clients;
+        for (std::size_t i = 0; i < options.load; ++i)
+            clients.push_back(std::make_unique<Net::Client>(options.host, options.port));
+
+        std::uint64_t lastBytes = 0, lastSnapshots = 0;
+        for (auto second = 1.f; second <= options.seconds; ++second)
+        {
+            sf::sleep(sf::seconds(1.f));
+
+            std::size_t   connected = 0;
+            std::uint64_t bytes = 0, snapshots = 0;
+            for (auto && client : clients)
+            {
+                static_cast<void>(client->poll()); // As the simulation would
+                connected += client->connected();
+                bytes     += client->receivedBytes();
+                snapshots += client->snapshots();
+            }
+
+            spdlog::info("{}/{} connected | {} snapshots/s | {:.1f} KB/s", connected,
+                         clients.size(), snapshots - lastSnapshots,
+                         static_cast<float>(bytes - lastBytes) / 1024.f);
+            lastBytes     = bytes;
+            lastSnapshots = snapshots;
+        }
+    }
+} // !namespace
+
+int main(int argc, char * argv[]) try
+{
+    Core::AsyncLogging const logging("DarkOrbitServer");
+    auto const options = parseOptions(std::span(argv, static_cast<std::size_t>(argc)).subspan(1));
+    if (options.load > 0)
+        load(options);
+    else
+        serve(options);
+}
+catch (std::exception const & e)
+{
+    spdlog::critical(Core::formatExceptionStack(e));
+    return EXIT_FAILURE;
+}